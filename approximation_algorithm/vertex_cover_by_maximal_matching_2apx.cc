@@ -12,13 +12,17 @@
       u \in C または v \in C が成り立つもののこと
 
   # Complexity (n = |V|, m = |E|)
-    Time: O(n + m)
+    Time: O(n + m)（最大マッチングから作る場合は graph/general_maximum_matching.cc の時間）
     Space: O(n + m)
     Approximation ratio: 2
 
   # Usage
     - vc MinimalVertexCover(g): g の頂点被覆 vc を返す（vc はサイズ n の std::vector<bool>）
     　　　　　　　　　　　　　　　　　　　vc[v] := v が頂点被覆に含まれるかどうか
+    - vc MinimalVertexCover(g, mate): マッチング mate（mate[v] は v とマッチした頂点，なければ -1）の
+    　　　　　　　　　　　　　　　　　　　端点から作った g の頂点被覆 vc を返す
+    - int RemoveRedundantVertices(g, vc): 頂点被覆 vc から，隣接頂点がすべて vc に含まれる頂点を
+    　　　　　　　　　　　　　　　　　　　取り除いて，取り除いた頂点数を返す
     - bool CheckVertexCover(g, vc): vc が g の頂点被覆かどうかを判定
 
   # Description
@@ -31,6 +35,16 @@
     　また，M はマッチングなので異なる M の2辺を被覆する C* の頂点は異なる．
     　したがって，|M| <= |C*| が成り立つ．このとき，2|M| = |C| であるから，|C| <= 2|C*| となる．
 
+    証明から，任意のマッチング M について |M| <= |C*| なので，最大マッチング M* のサイズは |C*| の
+    下界として最も良い．グラフが小さくて最大マッチング（graph/general_maximum_matching.cc）が
+    十分速く求まるときは，M* の端点から頂点被覆を作って，得られた解が最適解の |C| / |M*| 倍以内で
+    あることを確認できる（最大マッチングは極大マッチングなので，端点の集合は頂点被覆になる）．
+    どちらの場合も，隣接頂点がすべて C に含まれる頂点は C から取り除いても頂点被覆のままなので，
+    そのような頂点を取り除いて解を改善する．
+
+  # Note
+    - main では n m <= MATCHING_THRESHOLD のときに最大マッチングを使う
+
   # References
     - [Wikipedia: Vertex cover Approximate evaluation]
       (https://en.wikipedia.org/wiki/Vertex_cover#Approximate_evaluation)
@@ -40,6 +54,8 @@
 #include <vector>
 #include <algorithm>
 
+//  @require ../graph/general_maximum_matching.cc 👇👇
+
 // -------------8<------- start of library -------8<------------------------
 struct Graph {
     int n;
@@ -60,6 +76,31 @@ std::vector<bool> MinimalVertexCover(const Graph &g) {
     return vc;
 }
 
+// vertex cover consisting of the endpoints of a matching (e.g. a maximum matching)
+std::vector<bool> MinimalVertexCover(const Graph &g, const std::vector<int> &mate) {
+    std::vector<bool> vc(g.n, false);
+    for (int v = 0; v < g.n; ++v)
+        if (0 <= mate[v]) vc[v] = true;
+    // the edges left uncovered when the matching is not maximal
+    for (int v = 0; v < g.n; ++v) {
+        for (int u : g.adj[v])
+            if (!vc[v] && !vc[u]) vc[v] = vc[u] = true;
+    }
+    return vc;
+}
+
+int RemoveRedundantVertices(const Graph &g, std::vector<bool> &vc) {
+    int removed = 0;
+    for (int v = 0; v < g.n; ++v) {
+        if (!vc[v]) continue;
+        bool redundant = true;
+        for (int u : g.adj[v])
+            if (!vc[u] || u == v) { redundant = false; break; }
+        if (redundant) { vc[v] = false; ++removed; }
+    }
+    return removed;
+}
+
 bool CheckVertexCover(const Graph &g, const std::vector<bool> &vc) {
     for (int v = 0; v < g.n; ++v)
         for (int u : g.adj[v])
@@ -80,7 +121,25 @@ int main() {
         g.add_edge(u, v);
     }
 
-    auto vc = MinimalVertexCover(g);
+    // the maximum matching is used when it is cheap enough
+    constexpr long long MATCHING_THRESHOLD = 100000000;
+    std::vector<bool> vc;
+    if ((long long)n * m <= MATCHING_THRESHOLD) {
+        GeneralMatching gm(n);
+        for (int v = 0; v < n; ++v)
+            for (int u : g.adj[v]) if (v < u) gm.add_edge(v, u);
+        const int lower_bound = gm.MaximumMatching();
+        std::vector<int> mate(n);
+        for (int v = 0; v < n; ++v) mate[v] = gm.Mate(v);
+        vc = MinimalVertexCover(g, mate);
+        std::cout << "The size of a maximum matching (a lower bound) is "
+                  << lower_bound << std::endl;
+    }
+    else {
+        vc = MinimalVertexCover(g);
+    }
+    RemoveRedundantVertices(g, vc);
+
     std::cout << "Is vc is a vertex cover?: "
               << (CheckVertexCover(g, vc) ? "Yes" : "No") << std::endl;
     std::cout << "The size of the vertex cover is "
@@ -0,0 +1,86 @@
+/*
+  0-1 BFS: std::deque vs. Dial's circular buckets
+  ===============================================
+  * Assumed input is a grid maze where breaking a wall costs 1
+
+  Comparing the execution time of
+    1. Graph<int>::BinaryBfs() in graph/01bfs.cc (std::deque)
+    2. Graph<int>::DialBfs()   in graph/01bfs.cc (K + 1 = 2 circular buckets reused across calls)
+
+  Input: w x w grid (n = w^2 vertices, about 4n arcs). Each cell is a wall with probability
+         0.3. Moving into a free cell costs 0 and moving into a wall costs 1.
+         Each value is the average over 5 sources.
+
+  Result executed this code on my computer.
+    - OS : Debian GNU/Linux 12 (bookworm)
+    - Processor: Intel Xeon Processor (1 core)
+    - Compiler : gcc version 12.2.0 (-O2)
+  ==============================================================================
+                         w = 500      w = 1000     w = 2000
+  ==============================================================================
+  BinaryBfs (deque) :   20.4 [ms]  129.1 [ms]  517.1 [ms]
+  DialBfs (buckets) :   16.1 [ms]   98.5 [ms]  415.3 [ms]
+  ------------------------------------------------------------------------------
+*/
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <string>
+
+//  @require ../graph/01bfs.cc 👇👇
+
+int main() {
+    namespace cn = std::chrono;
+    std::mt19937 rng(0);
+    const std::vector<std::string> name = {
+        "BinaryBfs (deque)",
+        "DialBfs (buckets)",
+    };
+
+    std::vector<std::vector<double>> res(name.size());
+    for (const int w : {500, 1000, 2000}) {
+        const int n = w * w;
+        std::vector<char> wall(n);
+        for (auto &x : wall) x = (rng() % 10 < 3);
+
+        Graph<int> g(n, 0);
+        for (int i = 0; i < w; ++i)
+            for (int j = 0; j < w; ++j) {
+                const int v = i * w + j;
+                if (i + 1 < w) { g.add_edge(v, v + w, wall[v + w]); g.add_edge(v + w, v, wall[v]); }
+                if (j + 1 < w) { g.add_edge(v, v + 1, wall[v + 1]); g.add_edge(v + 1, v, wall[v]); }
+            }
+
+        std::vector<int> sources(5);
+        for (auto &s : sources) s = rng() % n;
+
+        long long sum[2] = {0, 0}, check[2] = {0, 0};
+        for (const int s : sources) {
+            for (int k = 0; k < 2; ++k) {
+                const auto start = cn::high_resolution_clock::now();
+                if (k == 0) {
+                    g.s = s; std::fill(g.d.begin(), g.d.end(), g.INF);
+                    g.BinaryBfs();
+                }
+                else g.ChangeSource(s);
+                const auto end = cn::high_resolution_clock::now();
+                sum[k] += cn::duration_cast<cn::microseconds>(end - start).count();
+                for (int v = 0; v < n; ++v) check[k] += g.distance(v);
+            }
+        }
+        if (check[0] != check[1]) std::cerr << "wrong answer" << std::endl;
+        for (int k = 0; k < 2; ++k) res[k].push_back(sum[k] / 1000.0 / sources.size());
+    }
+
+    std::cout << "                         w = 500      w = 1000     w = 2000\n";
+    for (std::size_t i = 0; i < name.size(); ++i) {
+        std::cout << "  " << name[i] << " :";
+        for (auto t : res[i]) std::cout << std::setw(7) << std::fixed << std::setprecision(1) << t << " [ms]";
+        std::cout << '\n';
+    }
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+/*
+  Bipartite maximum matching: augmenting path DFS vs. Hopcroft-Karp
+  =================================================================
+  * Assumed input is a large sparse bipartite graph (|A| = |B| = k)
+
+  Comparing the execution time of MaximumMatching() in
+    1. the former graph/bipartite_maximum_matching.cc (one DFS from every vertex of A,
+       visited is reset before each DFS, recursive)
+    2. graph/bipartite_maximum_matching.cc (Karp-Sipser initial matching + Hopcroft-Karp
+       on a CSR graph, non-recursive)
+
+  Input: each vertex of A has d random neighbors in B (d = 2 and d = 5).
+         The time includes building the graph. The former version is only run for k = 10^4
+         (it takes Θ(k^2) time to reset visited, and one DFS can visit the whole graph).
+
+  My opinion
+    On these random graphs Karp-Sipser already finds (almost) a maximum matching, so
+    Hopcroft-Karp needs only a few phases. For k = 10^6 and d = 5, building the CSR graph
+    and the initial matching take most of the time.
+
+  Result executed this code on my computer.
+    - OS : Debian GNU/Linux 12 (bookworm)
+    - Processor: Intel Xeon Processor (1 core)
+    - Compiler : gcc version 12.2.0 (-O2)
+  ==============================================================================
+                            k = 10^4      k = 10^5      k = 10^6
+  ==============================================================================
+  former        (d = 2) :     22.0 [ms]             -             -
+  Hopcroft-Karp (d = 2) :      2.8 [ms]     70.3 [ms]   1325.8 [ms]
+  former        (d = 5) :    399.0 [ms]             -             -
+  Hopcroft-Karp (d = 5) :     10.3 [ms]    153.2 [ms]   3027.8 [ms]
+  ------------------------------------------------------------------------------
+*/
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <string>
+
+//  @require ../graph/bipartite_maximum_matching.cc 👇👇
+
+// the former graph/bipartite_maximum_matching.cc
+class FormerBipariteGraph {
+public:
+    FormerBipariteGraph(int _L, int _R)
+        : L(_L), R(_R), adj(L + R), match(L + R, -1), visited(L + R), size_match(0) {}
+
+    void add_edge(const int v1, const int v2) {
+        adj[v1].push_back(L + v2);
+        adj[L + v2].push_back(v1);
+    }
+
+    int MaximumMatching() {
+        for (int v = 0; v < L; ++v) {
+            visited.assign(L + R, false);
+            if (Augment(v)) ++size_match;
+        }
+        return size_match;
+    }
+
+private:
+    const int L, R;
+    std::vector<std::vector<int>> adj;
+    std::vector<int> match;
+    std::vector<char> visited;
+    int size_match;
+
+    bool Augment(const int cur) {
+        for (const int dst : adj[cur])
+            if (!visited[dst]) {
+                visited[dst] = true;
+                if (match[dst] < 0 || Augment(match[dst])) {
+                    match[cur] = dst; match[dst] = cur;
+                    return true;
+                }
+            }
+        return false;
+    }
+};
+
+template<class Graph>
+double Solve(const int k, const std::vector<std::pair<int, int>> &edges, int &size) {
+    namespace cn = std::chrono;
+    const auto start = cn::high_resolution_clock::now();
+    Graph g(k, k);
+    for (const auto &e : edges) g.add_edge(e.first, e.second);
+    size = g.MaximumMatching();
+    const auto end = cn::high_resolution_clock::now();
+    return cn::duration_cast<cn::microseconds>(end - start).count() / 1000.0;
+}
+
+int main() {
+    std::mt19937 rng(0);
+    const std::vector<std::string> name = {
+        "former        (d = 2)",
+        "Hopcroft-Karp (d = 2)",
+        "former        (d = 5)",
+        "Hopcroft-Karp (d = 5)",
+    };
+
+    std::vector<std::vector<double>> res(name.size());
+    for (const int k : {10000, 100000, 1000000}) {
+        for (int type = 0; type < 2; ++type) {
+            const int d = (type == 0 ? 2 : 5);
+            std::vector<std::pair<int, int>> edges;
+            for (int a = 0; a < k; ++a)
+                for (int j = 0; j < d; ++j) edges.emplace_back(a, rng() % k);
+
+            int s1 = -1, s2;
+            res[2 * type].push_back(k <= 10000 ? Solve<FormerBipariteGraph>(k, edges, s1) : -1);
+            res[2 * type + 1].push_back(Solve<BipariteGraph>(k, edges, s2));
+            if (s1 != -1 && s1 != s2) std::cerr << "wrong answer" << std::endl;
+        }
+    }
+
+    std::cout << "                            k = 10^4      k = 10^5      k = 10^6\n";
+    for (std::size_t i = 0; i < name.size(); ++i) {
+        std::cout << "  " << name[i] << " :";
+        for (auto t : res[i]) {
+            if (t < 0) std::cout << std::setw(14) << "-";
+            else std::cout << std::setw(9) << std::fixed << std::setprecision(1) << t << " [ms]";
+        }
+        std::cout << '\n';
+    }
+
+    return 0;
+}
@@ -0,0 +1,176 @@
+/*
+  Maximum weight bipartite perfect matching: textbook Hungarian vs. flat Hungarian vs. auction
+  ============================================================================================
+  * Assumed input is an assignment problem with |A| = |B| = n
+
+  Comparing the execution time of
+    1. the textbook Hungarian method (std::vector<std::vector<T>> cost matrix, O(n^3))
+    2. HungarianMatching<T>::MaximumWeightPerfectMatching() in graph/bipartite_maximum_weight_matching.cc
+    3. AuctionMatching<T>::MaximumWeightPerfectMatching() in graph/bipartite_maximum_weight_matching.cc
+       (p = 1 thread, since the machine below has only one core)
+
+  Input: dense : all the n^2 edges, weights are uniformly random integers in [0, 10^6]
+         sparse: d = 10 edges per vertex of A ({a, a} and 9 random ones) with random weights
+                 in [0, 10^6] (1 and 2 treat the missing edges as forbidden)
+         The time includes building the graph. 1 and 2 are not run for n = 10^5 (n^2 matrix),
+         and only 2 is run for the dense input with n = 5000 (memory).
+
+  My opinion
+    The flat matrix, the column reduction and the branch-free loops make the Hungarian method
+    about twice as fast as the textbook one. The auction algorithm is much faster on sparse
+    graphs, but on dense graphs every bid scans a whole row and the Hungarian method wins.
+
+  Result executed this code on my computer.
+    - OS : Debian GNU/Linux 12 (bookworm)
+    - Processor: Intel Xeon Processor (1 core)
+    - Compiler : gcc version 12.2.0 (-O2)
+  ==============================================================================
+                                  n = 1000      n = 2000      n = 5000     n = 10^5
+  ==============================================================================
+  textbook Hungarian  (dense)  :    247.7 [ms]   1477.2 [ms]             -             -
+  HungarianMatching   (dense)  :    124.4 [ms]    709.7 [ms]   5351.1 [ms]             -
+  AuctionMatching     (dense)  :    466.3 [ms]   1995.7 [ms]             -             -
+  textbook Hungarian  (sparse) :    209.3 [ms]   1152.6 [ms]  14896.6 [ms]             -
+  HungarianMatching   (sparse) :    144.5 [ms]    611.1 [ms]   4984.1 [ms]             -
+  AuctionMatching     (sparse) :      7.2 [ms]     13.6 [ms]     32.7 [ms]   1604.4 [ms]
+  ------------------------------------------------------------------------------
+*/
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <string>
+#include <limits>
+#include <tuple>
+
+//  @require ../graph/bipartite_maximum_weight_matching.cc 👇👇
+
+// the textbook Hungarian method with potentials (minimizes -w)
+template<class T>
+struct TextbookHungarian {
+    const T INF = std::numeric_limits<T>::max() / 4;
+    int n;
+    std::vector<std::vector<T>> a;
+
+    TextbookHungarian(int _n, int) : n(_n), a(n + 1, std::vector<T>(n + 1, INF)) {}
+
+    void add_edge(int x, int y, T w) { a[x + 1][y + 1] = std::min(a[x + 1][y + 1], -w); }
+
+    T MaximumWeightPerfectMatching() {
+        std::vector<T> u(n + 1), v(n + 1), minv(n + 1);
+        std::vector<int> p(n + 1), way(n + 1);
+        std::vector<char> used(n + 1);
+        for (int i = 1; i <= n; ++i) {
+            p[0] = i;
+            int j0 = 0;
+            minv.assign(n + 1, INF);
+            used.assign(n + 1, false);
+            do {
+                used[j0] = true;
+                int i0 = p[j0], j1 = 0;
+                T delta = INF;
+                for (int j = 1; j <= n; ++j)
+                    if (!used[j]) {
+                        const T cur = a[i0][j] - u[i0] - v[j];
+                        if (cur < minv[j]) { minv[j] = cur; way[j] = j0; }
+                        if (minv[j] < delta) { delta = minv[j]; j1 = j; }
+                    }
+                for (int j = 0; j <= n; ++j)
+                    if (used[j]) { u[p[j]] += delta; v[j] -= delta; }
+                    else minv[j] -= delta;
+                j0 = j1;
+            } while (p[j0] != 0);
+            do {
+                const int j1 = way[j0];
+                p[j0] = p[j1];
+                j0 = j1;
+            } while (j0);
+        }
+        T res = 0;
+        for (int j = 1; j <= n; ++j) res -= a[p[j]][j];
+        return res;
+    }
+};
+
+using Edge = std::tuple<int, int, long long>;
+
+template<class Matching>
+double Solve(const int n, const std::vector<Edge> &edges, long long &res) {
+    namespace cn = std::chrono;
+    const auto start = cn::high_resolution_clock::now();
+    Matching g(n, n);
+    for (const auto &e : edges) g.add_edge(std::get<0>(e), std::get<1>(e), std::get<2>(e));
+    res = g.MaximumWeightPerfectMatching();
+    const auto end = cn::high_resolution_clock::now();
+    return cn::duration_cast<cn::microseconds>(end - start).count() / 1000.0;
+}
+
+template<class T>
+struct SingleThreadAuction : AuctionMatching<T> {
+    SingleThreadAuction(int L, int R) : AuctionMatching<T>(L, R, 1) {}
+};
+
+int main() {
+    std::mt19937 rng(0);
+    const std::vector<std::string> name = {
+        "textbook Hungarian  (dense) ",
+        "HungarianMatching   (dense) ",
+        "AuctionMatching     (dense) ",
+        "textbook Hungarian  (sparse)",
+        "HungarianMatching   (sparse)",
+        "AuctionMatching     (sparse)",
+    };
+
+    std::vector<std::vector<double>> res(name.size());
+    for (const int n : {1000, 2000, 5000, 100000}) {
+        for (int type = 0; type < 2; ++type) {
+            std::vector<Edge> edges;
+            if (type == 0) {
+                if (n == 5000) {
+                    // only HungarianMatching; the weights are generated in place to save memory
+                    namespace cn = std::chrono;
+                    const auto start = cn::high_resolution_clock::now();
+                    HungarianMatching<long long> g(n, n);
+                    for (int a = 0; a < n; ++a)
+                        for (int b = 0; b < n; ++b) g.add_edge(a, b, rng() % 1000001);
+                    g.MaximumWeightPerfectMatching();
+                    const auto end = cn::high_resolution_clock::now();
+                    res[0].push_back(-1);
+                    res[1].push_back(cn::duration_cast<cn::microseconds>(end - start).count() / 1000.0);
+                    res[2].push_back(-1);
+                    continue;
+                }
+                if (2000 < n) { for (int k = 0; k < 3; ++k) res[k].push_back(-1); continue; }
+                for (int a = 0; a < n; ++a)
+                    for (int b = 0; b < n; ++b) edges.emplace_back(a, b, rng() % 1000001);
+            }
+            else {
+                for (int a = 0; a < n; ++a) {
+                    edges.emplace_back(a, a, rng() % 1000001);
+                    for (int k = 1; k < 10; ++k) edges.emplace_back(a, rng() % n, rng() % 1000001);
+                }
+            }
+
+            long long r[3] = {-1, -1, -1};
+            const bool small = (n <= 5000);
+            res[3 * type].push_back(small ? Solve<TextbookHungarian<long long>>(n, edges, r[0]) : -1);
+            res[3 * type + 1].push_back(small ? Solve<HungarianMatching<long long>>(n, edges, r[1]) : -1);
+            res[3 * type + 2].push_back(Solve<SingleThreadAuction<long long>>(n, edges, r[2]));
+            if (small && (r[0] != r[1] || r[1] != r[2])) std::cerr << "wrong answer" << std::endl;
+        }
+    }
+
+    std::cout << "                                  n = 1000      n = 2000      n = 5000     n = 10^5\n";
+    for (std::size_t i = 0; i < name.size(); ++i) {
+        std::cout << "  " << name[i] << " :";
+        for (auto t : res[i]) {
+            if (t < 0) std::cout << std::setw(14) << "-";
+            else std::cout << std::setw(9) << std::fixed << std::setprecision(1) << t << " [ms]";
+        }
+        std::cout << '\n';
+    }
+
+    return 0;
+}
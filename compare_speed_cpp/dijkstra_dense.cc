@@ -0,0 +1,140 @@
+/*
+  Dijkstra's algorithm on dense graphs: adjacency matrix vs. heap
+  ===============================================================
+  * Assumed input is a dense directed graph with non-negative integer weights
+
+  Comparing the execution time of Graph<int>::Dijkstra() in
+    1. graph/dijkstra_heap.cc (adjacency list and binary heap, O((n + m) log n))
+    2. graph/dijkstra.cc      (flat adjacency matrix and linear scan, O(n^2))
+    3. the former graph/dijkstra.cc (std::vector<std::vector<int>> and std::vector<bool>, O(n^2))
+
+  Input: directed graph with n vertices where each of the n (n - 1) arcs exists with
+         probability p. Arc weights are uniformly random integers in [1, 10^6].
+         Each value is the average over 5 sources (the time to build the graph is excluded).
+
+  My opinion
+    With uniformly random weights only O(n log n) arcs decrease a distance, so the heap
+    version stays fast on dense graphs. The adjacency matrix pays off only for complete
+    (or almost complete) graphs and only when SIMD instructions are enabled (-mavx2).
+
+  Result executed this code on my computer.
+    - OS : Debian GNU/Linux 12 (bookworm)
+    - Processor: Intel Xeon Processor (1 core)
+    - Compiler : gcc version 12.2.0
+  ==============================================================================
+  n = 5000                        p = 0.01     p = 0.05     p = 0.2      p = 1.0
+  ==============================================================================
+  -O2
+    heap  (dijkstra_heap.cc) :    4.2 [ms]    8.5 [ms]   17.6 [ms]   57.3 [ms]
+    matrix (dijkstra.cc)     :   72.0 [ms]   66.3 [ms]   70.7 [ms]   71.4 [ms]
+    matrix (former)          :  108.2 [ms]  131.9 [ms]  180.6 [ms]  116.0 [ms]
+  -O2 -mavx2
+    heap  (dijkstra_heap.cc) :    4.3 [ms]    9.0 [ms]   18.4 [ms]   57.9 [ms]
+    matrix (dijkstra.cc)     :   37.3 [ms]   37.9 [ms]   38.9 [ms]   36.1 [ms]
+    matrix (former)          :  113.7 [ms]  135.9 [ms]  210.6 [ms]  102.1 [ms]
+  ------------------------------------------------------------------------------
+*/
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <string>
+#include <limits>
+#include <algorithm>
+
+namespace heap {
+//  @require ../graph/dijkstra_heap.cc 👇👇
+}
+
+namespace dense {
+//  @require ../graph/dijkstra.cc 👇👇
+}
+
+// the former graph/dijkstra.cc
+struct NaiveGraph {
+    const int INF = std::numeric_limits<int>::max();
+    const int n;
+    int s;
+    std::vector<std::vector<int>> adj;
+    std::vector<int> d;
+
+    NaiveGraph(int _n, int _s) : n(_n), s(_s), adj(n, std::vector<int>(n, INF)), d(n, INF) { }
+    void add_arc(int u, int v, int w) { adj[u][v] = w; }
+    int distance(const int t) const { return d[t]; }
+    void ChangeSource(const int _s) { s = _s; std::fill(d.begin(), d.end(), INF); Dijkstra(); }
+
+    void Dijkstra() {
+        std::vector<bool> used(n, false);
+        d[s] = 0;
+        while (true) {
+            int v = -1;
+            for (int u = 0; u < n; ++u)
+                if (!used[u] && (v == -1 || d[u] < d[v])) v = u;
+            if (v == -1 || INF <= d[v]) break;
+            used[v] = true;
+            for (int u = 0; u < n; ++u)
+                if (adj[v][u] != INF) d[u] = std::min(d[u], d[v] + adj[v][u]);
+        }
+    }
+};
+
+template<class G>
+double Solve(G &g, const std::vector<int> &sources, std::vector<long long> &check) {
+    namespace cn = std::chrono;
+    long long sum_time = 0;
+    for (const int s : sources) {
+        const auto start = cn::high_resolution_clock::now();
+        g.ChangeSource(s);
+        const auto end = cn::high_resolution_clock::now();
+        sum_time += cn::duration_cast<cn::microseconds>(end - start).count();
+        long long sum = 0;
+        for (int v = 0; v < g.n; ++v) if (g.distance(v) < g.INF) sum += g.distance(v);
+        check.push_back(sum);
+    }
+    return sum_time / 1000.0 / sources.size();
+}
+
+int main() {
+    const int n = 5000;
+    const std::vector<double> density = {0.01, 0.05, 0.2, 1.0};
+    const std::vector<std::string> name = {
+        "heap  (dijkstra_heap.cc)",
+        "matrix (dijkstra.cc)    ",
+        "matrix (former)         ",
+    };
+
+    std::mt19937 rng(0);
+    std::vector<int> sources(5);
+    for (auto &s : sources) s = rng() % n;
+
+    std::vector<std::vector<double>> res(name.size());
+    for (const double p : density) {
+        heap::Graph<int> g1(n, 0);
+        dense::Graph<int> g2(n, 0);
+        NaiveGraph g3(n, 0);
+        std::bernoulli_distribution exist(p);
+        for (int u = 0; u < n; ++u)
+            for (int v = 0; v < n; ++v)
+                if (u != v && exist(rng)) {
+                    const int w = rng() % 1000000 + 1;
+                    g1.add_arc(u, v, w); g2.add_arc(u, v, w); g3.add_arc(u, v, w);
+                }
+
+        std::vector<long long> check1, check2, check3;
+        res[0].push_back(Solve(g1, sources, check1));
+        res[1].push_back(Solve(g2, sources, check2));
+        res[2].push_back(Solve(g3, sources, check3));
+        if (check1 != check2 || check1 != check3) std::cerr << "wrong answer" << std::endl;
+    }
+
+    std::cout << "n = " << n << "              p = 0.01     p = 0.05     p = 0.2      p = 1.0\n";
+    for (std::size_t i = 0; i < name.size(); ++i) {
+        std::cout << "  " << name[i] << " :";
+        for (auto t : res[i]) std::cout << std::setw(7) << std::fixed << std::setprecision(1) << t << " [ms]";
+        std::cout << '\n';
+    }
+
+    return 0;
+}
@@ -0,0 +1,95 @@
+/*
+  Priority queues for Dijkstra's algorithm on integer weights
+  ===========================================================
+  * Assumed input is a road-network-like grid graph with non-negative integer weights
+
+  Comparing the execution time of Graph<T, Queue>::Dijkstra() in graph/dijkstra_heap.cc
+    1. BinaryHeap<T> (binary heap with lazy deletion, the default)
+    2. RadixHeap<T>  (monotone radix heap)
+    3. DialQueue<T>  (Dial's circular bucket queue)
+
+  Input: w x w grid graph (n = w^2 vertices, about 4n arcs) whose arc weights are
+         uniformly random integers in [1, C]. Each value is the average over 5 sources.
+
+  My opinion
+    C is small (<= 10^3)   -> DialQueue
+    C is large             -> RadixHeap (DialQueue needs C + 1 buckets per sweep)
+
+  Result executed this code on my computer.
+    - OS : Debian GNU/Linux 12 (bookworm)
+    - Processor: Intel Xeon Processor (1 core)
+    - Compiler : gcc version 12.2.0 (-O2)
+  ==============================================================================
+  n = 1000000 (w = 1000)        C = 10        C = 1000      C = 100000
+  ==============================================================================
+    BinaryHeap<int> :      352 [ms]      341 [ms]      298 [ms]
+     RadixHeap<int> :      122 [ms]      195 [ms]      203 [ms]
+     DialQueue<int> :      118 [ms]      124 [ms]      468 [ms]
+  ------------------------------------------------------------------------------
+*/
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <string>
+
+//  @require ../graph/dijkstra_heap.cc 👇👇
+
+template<class Queue>
+long long Solve(const int w, const std::vector<int> &weight, const std::vector<int> &sources) {
+    const int n = w * w;
+    Graph<int, Queue> g(n, sources[0]);
+    int idx = 0;
+    for (int i = 0; i < w; ++i)
+        for (int j = 0; j < w; ++j) {
+            const int v = i * w + j;
+            if (i + 1 < w) { g.add_arc(v, v + w, weight[idx++]); g.add_arc(v + w, v, weight[idx++]); }
+            if (j + 1 < w) { g.add_arc(v, v + 1, weight[idx++]); g.add_arc(v + 1, v, weight[idx++]); }
+        }
+
+    namespace cn = std::chrono;
+    long long sum_time = 0, check = 0;
+    for (const int s : sources) {
+        const auto start = cn::high_resolution_clock::now();
+        g.ChangeSource(s);
+        const auto end = cn::high_resolution_clock::now();
+        sum_time += cn::duration_cast<cn::milliseconds>(end - start).count();
+        check += g.distance(n - 1 - s);
+    }
+    if (check < 0) std::cerr << "unreachable" << std::endl;
+    return sum_time / sources.size();
+}
+
+int main() {
+    const int w = 1000, n = w * w;
+    const std::vector<int> max_weight = {10, 1000, 100000};
+    const std::vector<std::string> name = {
+        "BinaryHeap<int>",
+        " RadixHeap<int>",
+        " DialQueue<int>",
+    };
+
+    std::mt19937 rng(0);
+    std::vector<int> sources(5);
+    for (auto &s : sources) s = rng() % n;
+
+    std::vector<std::vector<long long>> res(name.size());
+    for (const int C : max_weight) {
+        std::vector<int> weight(4 * n);
+        for (auto &x : weight) x = rng() % C + 1;
+        res[0].push_back(Solve<BinaryHeap<int>>(w, weight, sources));
+        res[1].push_back(Solve<RadixHeap<int>>(w, weight, sources));
+        res[2].push_back(Solve<DialQueue<int>>(w, weight, sources));
+    }
+
+    std::cout << "n = " << n << " (w = " << w << ")        C = 10        C = 1000      C = 100000\n";
+    for (std::size_t i = 0; i < name.size(); ++i) {
+        std::cout << "  " << name[i] << " :";
+        for (auto t : res[i]) std::cout << std::setw(9) << std::right << t << " [ms]";
+        std::cout << '\n';
+    }
+
+    return 0;
+}
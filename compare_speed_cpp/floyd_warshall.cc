@@ -0,0 +1,130 @@
+/*
+  Blocked Floyd-Warshall vs. textbook Floyd-Warshall
+  ==================================================
+  * Assumed input is a dense directed graph with non-negative integer weights
+
+  Comparing the execution time of
+    1. textbook triple loop on std::vector<std::vector<int>> (the former graph/floyd_warshall.cc)
+    2. Graph<int>::FloydWarshall() in graph/floyd_warshall.cc (blocked, flat matrix)
+    3. 2. with path reconstruction (Graph<int> g(n, true)), which also keeps the number of arcs
+       to break ties between the paths with the same distance
+
+  Input: complete directed graph with n vertices whose arc weights are uniformly random
+         integers in [1, 10^6]
+
+  Result executed this code on my computer.
+    - OS : Debian GNU/Linux 12 (bookworm)
+    - Processor: Intel Xeon Processor (1 core)
+    - Compiler : gcc version 12.2.0
+  ==============================================================================
+                        n = 500      n = 1000     n = 2000
+  ==============================================================================
+  -O2
+    textbook          :  402 [ms]   2403 [ms]  23778 [ms]
+    blocked           :  130 [ms]    876 [ms]   8098 [ms]
+    blocked + path    :  528 [ms]   3850 [ms]  32670 [ms]
+  -O2 -mavx2
+    textbook          :  330 [ms]   2090 [ms]  17819 [ms]
+    blocked           :   40 [ms]    584 [ms]   4537 [ms]
+    blocked + path    :  219 [ms]   1716 [ms]  16352 [ms]
+  ------------------------------------------------------------------------------
+*/
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <string>
+
+//  @require ../graph/floyd_warshall.cc 👇👇
+
+std::vector<std::vector<int>> TextbookFloydWarshall(std::vector<std::vector<int>> d) {
+    const int n = d.size(), INF = std::numeric_limits<int>::max();
+    for (int k = 0; k < n; ++k)
+        for (int i = 0; i < n; ++i) {
+            if (INF <= d[i][k]) continue;
+            for (int j = 0; j < n; ++j) {
+                if (INF <= d[k][j]) continue;
+                d[i][j] = std::min(d[i][j], d[i][k] + d[k][j]);
+            }
+        }
+    return d;
+}
+
+// the path from nxt must reach t with the shortest distance, even with zero-weight cycles
+bool CheckPaths(std::mt19937 &rng) {
+    for (int iter = 0; iter < 100; ++iter) {
+        const int n = rng() % 151 + 65;
+        std::vector<std::vector<long long>> w(n, std::vector<long long>(n, -1));
+        Graph<long long> g(n, true, 1);
+        for (int i = 0; i < 4 * n; ++i) {
+            const int u = rng() % n, v = rng() % n;
+            if (u == v) continue;
+            const long long c = rng() % 4;
+            if (w[u][v] < 0 || c < w[u][v]) w[u][v] = c;
+            g.add_arc(u, v, c);
+        }
+        g.FloydWarshall();
+        for (int s = 0; s < n; ++s)
+            for (int t = 0; t < n; ++t) {
+                if (g.INF <= g.distance(s, t)) continue;
+                const auto path = g.ShortestPath(s, t);
+                if (path.empty() || n < (int)path.size() || path.back() != t) return false;
+                long long len = 0;
+                for (std::size_t i = 0; i + 1 < path.size(); ++i) {
+                    if (w[path[i]][path[i + 1]] < 0) return false;
+                    len += w[path[i]][path[i + 1]];
+                }
+                if (len != g.distance(s, t)) return false;
+            }
+    }
+    return true;
+}
+
+int main() {
+    namespace cn = std::chrono;
+    std::mt19937 rng(0);
+    if (!CheckPaths(rng)) { std::cerr << "wrong path" << std::endl; return 1; }
+    const std::vector<std::string> name = {
+        "textbook      ",
+        "blocked       ",
+        "blocked + path",
+    };
+
+    std::vector<std::vector<long long>> res(name.size());
+    for (const int n : {500, 1000, 2000}) {
+        std::vector<std::vector<int>> w(n, std::vector<int>(n, 0));
+        for (int i = 0; i < n; ++i)
+            for (int j = 0; j < n; ++j)
+                if (i != j) w[i][j] = rng() % 1000000 + 1;
+
+        auto start = cn::high_resolution_clock::now();
+        const auto d = TextbookFloydWarshall(w);
+        auto end = cn::high_resolution_clock::now();
+        res[0].push_back(cn::duration_cast<cn::milliseconds>(end - start).count());
+
+        for (int k = 0; k < 2; ++k) {
+            Graph<int> g(n, k == 1);
+            for (int i = 0; i < n; ++i)
+                for (int j = 0; j < n; ++j)
+                    if (i != j) g.add_arc(i, j, w[i][j]);
+            start = cn::high_resolution_clock::now();
+            g.FloydWarshall();
+            end = cn::high_resolution_clock::now();
+            res[k + 1].push_back(cn::duration_cast<cn::milliseconds>(end - start).count());
+            for (int i = 0; i < n; ++i)
+                for (int j = 0; j < n; ++j)
+                    if (d[i][j] != g.distance(i, j)) { std::cerr << "wrong answer" << std::endl; return 1; }
+        }
+    }
+
+    std::cout << "                   n = 500     n = 1000    n = 2000\n";
+    for (std::size_t i = 0; i < name.size(); ++i) {
+        std::cout << "  " << name[i] << "  :";
+        for (auto t : res[i]) std::cout << std::setw(7) << std::right << t << " [ms]";
+        std::cout << '\n';
+    }
+
+    return 0;
+}
@@ -0,0 +1,131 @@
+/*
+  Lowest common ancestor: online structures vs. Tarjan's offline algorithm
+  ==========================================================================
+  * Assumed input is a random rooted tree and q = 10^6 queries known in advance
+
+  Comparing the execution time of building the structure and answering all the queries in
+    1. graph/lca_doubling.cc (O(n log n) preprocessing, O(log n) query)
+    2. graph/lca_euler_tour.cc (segment tree over the Euler tour, O(log n) query)
+    3. graph/lca_farach_colton_bender.cc (block decomposition RMQ, O(1) query, 1 thread)
+    4. graph/lca_tarjan_offline.cc (one DFS with union-find, all the queries at once)
+
+  Input: the parent of vertex v (1 <= v < n) is chosen uniformly from [0, v), and the labels
+         are shuffled. The queries are uniformly random pairs of vertices.
+
+  My opinion
+    Tarjan's algorithm is 2-4 times faster than doubling and the Euler tour, but the O(1)-query
+    structure is still about 2 times faster: Tarjan has to bucket the queries by vertex and
+    then visits them in DFS order, which causes random accesses to both the queries and the
+    union-find. Its advantage is the memory: it keeps no table, only O(n + q) words.
+    Doubling and the segment tree pay O(log n) dependent random accesses per query.
+
+  Result executed this code on my computer.
+    - OS : Debian GNU/Linux 12 (bookworm)
+    - Processor: Intel Xeon Processor (1 core)
+    - Compiler : gcc version 12.2.0 (-O2)
+  ==============================================================================
+                                   n = 10^4      n = 10^5      n = 10^6
+  ==============================================================================
+  doubling                   :    213.6 [ms]    388.6 [ms]   2456.3 [ms]
+  euler tour + segment tree  :    456.6 [ms]    633.6 [ms]   2425.1 [ms]
+  Farach-Colton and Bender   :     33.4 [ms]     64.1 [ms]    686.9 [ms]
+  Tarjan (offline)           :    116.0 [ms]    268.1 [ms]   1308.8 [ms]
+  ------------------------------------------------------------------------------
+*/
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <string>
+#include <cmath>
+#include <climits>
+#include <algorithm>
+
+namespace doubling {
+//  @require ../graph/lca_doubling.cc 👇👇
+}
+
+namespace euler_tour {
+//  @require ../graph/lca_euler_tour.cc 👇👇
+}
+
+//  @require ../graph/lca_farach_colton_bender.cc 👇👇
+//  @require ../graph/lca_tarjan_offline.cc 👇👇
+
+using Edges = std::vector<std::pair<int, int>>;
+
+template<class LCA>
+double SolveOnline(const int n, const Edges &edges, const Edges &pairs, long long &check) {
+    namespace cn = std::chrono;
+    const auto start = cn::high_resolution_clock::now();
+    LCA lca(n, 0);
+    for (const auto &e : edges) lca.add_edge(e.first, e.second);
+    lca.Preprocessing();
+    check = 0;
+    for (const auto &p : pairs) check += lca.query(p.first, p.second);
+    const auto end = cn::high_resolution_clock::now();
+    return cn::duration_cast<cn::microseconds>(end - start).count() / 1000.0;
+}
+
+double SolveFCB(const int n, const Edges &edges, const Edges &pairs, long long &check) {
+    namespace cn = std::chrono;
+    const auto start = cn::high_resolution_clock::now();
+    LowestCommonAncestor lca(n, 0);
+    for (const auto &e : edges) lca.add_edge(e.first, e.second);
+    lca.Preprocessing();
+    check = 0;
+    for (const int w : lca.query(pairs, 1)) check += w;
+    const auto end = cn::high_resolution_clock::now();
+    return cn::duration_cast<cn::microseconds>(end - start).count() / 1000.0;
+}
+
+double SolveTarjan(const int n, const Edges &edges, const Edges &pairs, long long &check) {
+    namespace cn = std::chrono;
+    const auto start = cn::high_resolution_clock::now();
+    OfflineLowestCommonAncestor lca(n, 0);
+    for (const auto &e : edges) lca.add_edge(e.first, e.second);
+    check = 0;
+    for (const int w : lca.query(pairs)) check += w;
+    const auto end = cn::high_resolution_clock::now();
+    return cn::duration_cast<cn::microseconds>(end - start).count() / 1000.0;
+}
+
+int main() {
+    std::mt19937 rng(0);
+    const std::vector<std::string> name = {
+        "doubling                  ",
+        "euler tour + segment tree ",
+        "Farach-Colton and Bender  ",
+        "Tarjan (offline)          ",
+    };
+    const int q = 1000000;
+
+    std::vector<std::vector<double>> res(name.size());
+    for (const int n : {10000, 100000, 1000000}) {
+        std::vector<int> label(n);
+        for (int v = 0; v < n; ++v) label[v] = v;
+        std::shuffle(label.begin() + 1, label.end(), rng);  // the root is 0
+        Edges edges, pairs(q);
+        for (int v = 1; v < n; ++v) edges.emplace_back(label[rng() % v], label[v]);
+        for (auto &p : pairs) p = {rng() % n, rng() % n};
+
+        long long check[4];
+        res[0].push_back(SolveOnline<doubling::LowestCommonAncestor>(n, edges, pairs, check[0]));
+        res[1].push_back(SolveOnline<euler_tour::LowestCommonAncestor>(n, edges, pairs, check[1]));
+        res[2].push_back(SolveFCB(n, edges, pairs, check[2]));
+        res[3].push_back(SolveTarjan(n, edges, pairs, check[3]));
+        for (int i = 1; i < 4; ++i)
+            if (check[i] != check[0]) std::cerr << "wrong answer" << std::endl;
+    }
+
+    std::cout << "                                   n = 10^4      n = 10^5      n = 10^6\n";
+    for (std::size_t i = 0; i < name.size(); ++i) {
+        std::cout << "  " << name[i] << " :";
+        for (auto t : res[i]) std::cout << std::setw(9) << std::fixed << std::setprecision(1) << t << " [ms]";
+        std::cout << '\n';
+    }
+
+    return 0;
+}
@@ -0,0 +1,116 @@
+/*
+  Recursive vs. iterative lowlink (bridges and articulation points)
+  =================================================================
+  * Assumed input is a large sparse undirected graph
+
+  Comparing the execution time of
+    1. Graph::Bridge()             in graph/bridge.cc             (recursive DFS, adjacency list)
+    2. Graph::ArticulationPoints() in graph/articulation_point.cc (recursive DFS, adjacency list)
+    3. Lowlink<int>                in graph/lowlink.cc            (explicit stack, CSR; computes
+                                                                   bridges, articulation points and
+                                                                   both kinds of components at once)
+
+  Input:
+    - random: simple graph with n vertices and m = 2n uniformly random edges
+              (the DFS tree of the giant component is a long path, its depth is about n / 2)
+    - path  : path graph with n vertices (the DFS depth is n)
+  The time to build the graph is excluded.
+  "-" means the recursive version overflows the default 8 MB stack, so it is not measured.
+
+  Result executed this code on my computer.
+    - OS : Debian GNU/Linux 12 (bookworm)
+    - Processor: Intel Xeon Processor (1 core)
+    - Compiler : gcc version 12.2.0 (-O2)
+  ==============================================================================
+                      random n = 10^5  random n = 10^6  path n = 10^7
+  ==============================================================================
+  recursive bridge   :        18.7 [ms]                -                -
+  recursive art      :        19.9 [ms]                -                -
+  iterative lowlink  :        23.3 [ms]       615.5 [ms]       993.3 [ms]
+  ------------------------------------------------------------------------------
+*/
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <string>
+#include <set>
+
+namespace bridge {
+//  @require ../graph/bridge.cc 👇👇
+}
+
+namespace articulation {
+//  @require ../graph/articulation_point.cc 👇👇
+}
+
+//  @require ../graph/lowlink.cc 👇👇
+
+template<class F>
+double Measure(F f) {
+    namespace cn = std::chrono;
+    const auto start = cn::high_resolution_clock::now();
+    f();
+    const auto end = cn::high_resolution_clock::now();
+    return cn::duration_cast<cn::microseconds>(end - start).count() / 1000.0;
+}
+
+int main() {
+    std::mt19937 rng(0);
+    const std::vector<std::string> name = {
+        "recursive bridge  ",
+        "recursive art     ",
+        "iterative lowlink ",
+    };
+
+    std::vector<std::vector<double>> res(name.size());
+    for (int k = 0; k < 3; ++k) {
+        const int n = (k == 0 ? 100000 : k == 1 ? 1000000 : 10000000);
+        std::vector<std::pair<int, int>> edges;
+        if (k < 2) {
+            // simple graph (the recursive versions distinguish the parent by the vertex)
+            std::set<std::pair<int, int>> used;
+            while ((int)edges.size() < 2 * n) {
+                int u = rng() % n, v = rng() % n;
+                if (v < u) std::swap(u, v);
+                if (u != v && used.emplace(u, v).second) edges.emplace_back(u, v);
+            }
+        }
+        else for (int v = 0; v + 1 < n; ++v) edges.emplace_back(v, v + 1);
+
+        int num_bridge = -1, num_art = -1;
+        if (k == 0) {
+            bridge::Graph g1(n);
+            articulation::Graph g2(n);
+            for (auto e : edges) { g1.add_edge(e.first, e.second); g2.add_edge(e.first, e.second); }
+            res[0].push_back(Measure([&]() { num_bridge = g1.Bridge(); }));
+            res[1].push_back(Measure([&]() { num_art = g2.ArticulationPoints(); }));
+        }
+        else { res[0].push_back(-1); res[1].push_back(-1); }
+
+        CsrGraph<> g(n);
+        for (auto e : edges) g.add_edge(e.first, e.second);
+        g.build();
+        int check[2];
+        res[2].push_back(Measure([&]() {
+            Lowlink<> ll(g);
+            check[0] = ll.Bridge(); check[1] = ll.ArticulationPoints();
+        }));
+        if (k == 0 && (check[0] != num_bridge || check[1] != num_art))
+            std::cerr << "wrong answer" << std::endl;
+    }
+
+    std::cout << "                      random n = 10^5  random n = 10^6  path n = 10^7\n";
+    for (std::size_t i = 0; i < name.size(); ++i) {
+        std::cout << "  " << name[i] << " :";
+        for (auto t : res[i]) {
+            if (t < 0) std::cout << std::setw(17) << "-";
+            else std::cout << std::setw(12) << std::fixed << std::setprecision(1) << t << " [ms]";
+        }
+        std::cout << '\n';
+    }
+
+    return 0;
+}
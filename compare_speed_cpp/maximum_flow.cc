@@ -0,0 +1,94 @@
+/*
+  Maximum flow: Dinic vs. push-relabel on dense bipartite networks
+  ================================================================
+  * Assumed input is a dense bipartite assignment network
+
+  Comparing the execution time of MaximumFlow(s, t) in
+    1. Dinic<T>       in graph/maximum_flow_dinic.cc
+    2. PushRelabel<T> in graph/maximum_flow_push_relabel.cc
+
+  Input: s -> L (|L| = k), L -> R (|R| = k, each pair with probability 1/2), R -> t.
+         "unit"   : all the capacities are 1 (bipartite matching)
+         "random" : capacities of s -> L and R -> t are uniformly random in [1, 100],
+                    capacities of L -> R are uniformly random in [1, 10]
+         The time includes building the network (Dinic builds its arrays in MaximumFlow).
+
+  My opinion
+    Building and scanning the dense adjacency lists takes most of the time, so the two are
+    close. Push-relabel is a little faster with unit capacities.
+
+  Result executed this code on my computer.
+    - OS : Debian GNU/Linux 12 (bookworm)
+    - Processor: Intel Xeon Processor (1 core)
+    - Compiler : gcc version 12.2.0 (-O2)
+  ==============================================================================
+                                 k = 500      k = 1000      k = 2000
+  ==============================================================================
+  Dinic       (unit)   :     22.7 [ms]     87.2 [ms]    410.9 [ms]
+  PushRelabel (unit)   :     16.4 [ms]     73.1 [ms]    359.4 [ms]
+  Dinic       (random) :     23.6 [ms]     87.6 [ms]    407.8 [ms]
+  PushRelabel (random) :     22.8 [ms]     78.4 [ms]    383.7 [ms]
+  ------------------------------------------------------------------------------
+*/
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <string>
+#include <tuple>
+
+//  @require ../graph/maximum_flow_dinic.cc 👇👇
+//  @require ../graph/maximum_flow_push_relabel.cc 👇👇
+
+using Arc = std::tuple<int, int, long long>;
+
+template<class Algorithm>
+double Solve(const int n, const std::vector<Arc> &arcs, long long &flow) {
+    namespace cn = std::chrono;
+    const auto start = cn::high_resolution_clock::now();
+    Algorithm g(n);
+    for (const auto &a : arcs) g.add_arc(std::get<0>(a), std::get<1>(a), std::get<2>(a));
+    flow = g.MaximumFlow(n - 2, n - 1);
+    const auto end = cn::high_resolution_clock::now();
+    return cn::duration_cast<cn::microseconds>(end - start).count() / 1000.0;
+}
+
+int main() {
+    std::mt19937 rng(0);
+    const std::vector<std::string> name = {
+        "Dinic       (unit)  ",
+        "PushRelabel (unit)  ",
+        "Dinic       (random)",
+        "PushRelabel (random)",
+    };
+
+    std::vector<std::vector<double>> res(name.size());
+    for (const int k : {500, 1000, 2000}) {
+        const int n = 2 * k + 2, s = n - 2, t = n - 1;
+        for (int type = 0; type < 2; ++type) {
+            auto cap = [&](int c) { return type == 0 ? 1LL : (long long)(rng() % c + 1); };
+            std::vector<Arc> arcs;
+            for (int i = 0; i < k; ++i) arcs.emplace_back(s, i, cap(100));
+            for (int i = 0; i < k; ++i)
+                for (int j = 0; j < k; ++j)
+                    if (rng() % 2) arcs.emplace_back(i, k + j, cap(10));
+            for (int j = 0; j < k; ++j) arcs.emplace_back(k + j, t, cap(100));
+
+            long long f1, f2;
+            res[2 * type].push_back(Solve<Dinic<long long>>(n, arcs, f1));
+            res[2 * type + 1].push_back(Solve<PushRelabel<long long>>(n, arcs, f2));
+            if (f1 != f2) std::cerr << "wrong answer" << std::endl;
+        }
+    }
+
+    std::cout << "                               k = 500      k = 1000      k = 2000\n";
+    for (std::size_t i = 0; i < name.size(); ++i) {
+        std::cout << "  " << name[i] << " :";
+        for (auto t : res[i]) std::cout << std::setw(9) << std::fixed << std::setprecision(1) << t << " [ms]";
+        std::cout << '\n';
+    }
+
+    return 0;
+}
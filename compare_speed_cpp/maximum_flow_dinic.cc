@@ -0,0 +1,196 @@
+/*
+  Dinic's algorithm: flat arc array vs. adjacency list with recursion
+  ===================================================================
+  * Assumed input is a network with about 10^6 arcs
+
+  Comparing the execution time of MaximumFlow(s, t) in
+    1. the former graph/maximum_flow_dinic.cc (std::vector<std::vector<Edge>>, recursive DFS,
+       level and iter are allocated in every phase)
+    2. graph/maximum_flow_dinic.cc (arcs 2i / 2i + 1 in one array, CSR offsets, reused buffers,
+       non-recursive DFS)
+    3. graph/maximum_flow_dinic.cc with capacity scaling (MaximumFlow(s, t, true))
+
+  Input (the time includes building the network, since the flat version builds its arrays
+         in the first call of MaximumFlow)
+    random   : n = 10^5 vertices, m = 10^6 random arcs, capacities uniformly random in [1, 10^6],
+               s = 0 and t = n - 1 have 100 extra arcs each
+    grid     : 500 x 500 grid with arcs in both directions (about 10^6 arcs),
+               capacities uniformly random in [1, 10^6], s and t are opposite corners
+    bipartite: s -> L -> R -> t with |L| = |R| = 1000, all the 10^6 pairs in L x R,
+               capacities of s -> L and R -> t are uniformly random in [1, 10^3] and L -> R are 1
+
+  My opinion
+    The flat arrays mainly save the allocation of many small vectors and the cache misses
+    when the arcs are scanned. Capacity scaling needs more phases and does not pay off
+    for Dinic on these inputs, so it is off by default.
+
+  Result executed this code on my computer.
+    - OS : Debian GNU/Linux 12 (bookworm)
+    - Processor: Intel Xeon Processor (1 core)
+    - Compiler : gcc version 12.2.0 (-O2)
+  ==============================================================================
+                                   random         grid         bipartite
+  ==============================================================================
+  former Dinic           :   1544.5 [ms]    146.8 [ms]    643.0 [ms]
+  flat Dinic             :    577.2 [ms]    156.0 [ms]    453.5 [ms]
+  flat Dinic (scaling)   :   1300.7 [ms]    342.0 [ms]    481.4 [ms]
+  ------------------------------------------------------------------------------
+*/
+
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <string>
+#include <tuple>
+#include <limits>
+
+//  @require ../graph/maximum_flow_dinic.cc 👇👇
+
+// the former graph/maximum_flow_dinic.cc
+template<typename Weight>
+struct FormerDinic {
+    using weight_type = Weight;
+
+    struct Edge {
+        int src, dst, rev;
+        Weight weight;
+        Edge(int f, int t, Weight cap, int rev = 0) :
+            src(f), dst(t), rev(rev), weight(cap) {}
+    };
+
+    int n;
+    std::vector<std::vector<Edge>> adj;
+    const Weight INF;
+
+    explicit FormerDinic(int _n, Weight inf = std::numeric_limits<Weight>::max() / 10)
+        : n(_n), adj(n), INF(inf) {}
+
+    void add_arc(const int src, const int dst, const Weight cap) {
+        adj[src].emplace_back(Edge(src, dst, cap, adj[dst].size()));
+        adj[dst].emplace_back(Edge(dst, src, 0, adj[src].size() - 1));
+    }
+
+    void add_edge(const int src, const int dst, const Weight cap) {
+        add_arc(src, dst, cap);
+        add_arc(dst, src, cap);
+    }
+
+    Weight MaximumFlow(const int s, const int t) {
+        Weight flow = 0;
+        while(true) {
+            std::vector<int> level(n, -1);
+            LevelGraph(s, level);
+            if(level[t] == -1) break;
+
+            std::vector<size_t> iter(n);
+            Weight blocking_flow = 0;
+            while ((blocking_flow = AugmentingPath(s, INF, t, level, iter)) > 0)
+                flow += blocking_flow;
+        }
+
+        return flow;
+    }
+
+    void LevelGraph(const int s, std::vector<int> &level){
+        std::queue<int> que;
+        for (level[s] = 0, que.push(s); !que.empty(); ) {
+            const int v = que.front(); que.pop();
+            for (const auto &e : adj[v])
+                if(0 < e.weight && level[e.dst] == -1){
+                    level[e.dst] = level[v] + 1;
+                    que.push(e.dst);
+                }
+        }
+    }
+
+    Weight AugmentingPath(int v, Weight flow, const int t,
+                          std::vector<int> &level, std::vector<size_t> &iter) {
+        if(v == t) return flow;
+        for ( ; iter[v] < adj[v].size(); ++iter[v]) {
+            Edge &e = adj[v][iter[v]];
+
+            if(0 < e.weight && level[v] < level[e.dst]){
+                Weight d = AugmentingPath(e.dst, std::min(flow, e.weight), t, level, iter);
+                if(0 < d){
+                    e.weight -= d;
+                    adj[e.dst][e.rev].weight += d;
+                    return d;
+                }
+            }
+        }
+        return 0;
+    }
+};
+
+using Arc = std::tuple<int, int, long long>;
+
+template<class Algorithm, class... Args>
+double Solve(const int n, const std::vector<Arc> &arcs, const int s, const int t,
+             long long &flow, Args... args) {
+    namespace cn = std::chrono;
+    const auto start = cn::high_resolution_clock::now();
+    Algorithm g(n);
+    for (const auto &a : arcs) g.add_arc(std::get<0>(a), std::get<1>(a), std::get<2>(a));
+    flow = g.MaximumFlow(s, t, args...);
+    const auto end = cn::high_resolution_clock::now();
+    return cn::duration_cast<cn::microseconds>(end - start).count() / 1000.0;
+}
+
+int main() {
+    std::mt19937 rng(0);
+    const std::vector<std::string> name = {
+        "former Dinic          ",
+        "flat Dinic            ",
+        "flat Dinic (scaling)  ",
+    };
+
+    std::vector<std::vector<double>> res(name.size());
+    for (int type = 0; type < 3; ++type) {
+        int n, s, t;
+        std::vector<Arc> arcs;
+        if (type == 0) {
+            n = 100000; s = 0; t = n - 1;
+            for (int i = 0; i < 1000000; ++i) arcs.emplace_back(rng() % n, rng() % n, rng() % 1000000 + 1);
+            for (int i = 0; i < 100; ++i) {
+                arcs.emplace_back(s, rng() % n, rng() % 1000000 + 1);
+                arcs.emplace_back(rng() % n, t, rng() % 1000000 + 1);
+            }
+        }
+        else if (type == 1) {
+            const int w = 500;
+            n = w * w; s = 0; t = n - 1;
+            for (int i = 0; i < w; ++i)
+                for (int j = 0; j < w; ++j) {
+                    const int v = i * w + j;
+                    if (i + 1 < w) { arcs.emplace_back(v, v + w, rng() % 1000000 + 1); arcs.emplace_back(v + w, v, rng() % 1000000 + 1); }
+                    if (j + 1 < w) { arcs.emplace_back(v, v + 1, rng() % 1000000 + 1); arcs.emplace_back(v + 1, v, rng() % 1000000 + 1); }
+                }
+        }
+        else {
+            const int k = 1000;
+            n = 2 * k + 2; s = n - 2; t = n - 1;
+            for (int i = 0; i < k; ++i) arcs.emplace_back(s, i, rng() % 1000 + 1);
+            for (int i = 0; i < k; ++i)
+                for (int j = 0; j < k; ++j) arcs.emplace_back(i, k + j, 1);
+            for (int j = 0; j < k; ++j) arcs.emplace_back(k + j, t, rng() % 1000 + 1);
+        }
+
+        long long f[3];
+        res[0].push_back(Solve<FormerDinic<long long>>(n, arcs, s, t, f[0]));
+        res[1].push_back(Solve<Dinic<long long>>(n, arcs, s, t, f[1]));
+        res[2].push_back(Solve<Dinic<long long>>(n, arcs, s, t, f[2], true));
+        if (f[0] != f[1] || f[0] != f[2]) std::cerr << "wrong answer" << std::endl;
+    }
+
+    std::cout << "                                 random         grid         bipartite\n";
+    for (std::size_t i = 0; i < name.size(); ++i) {
+        std::cout << "  " << name[i] << " :";
+        for (auto t : res[i]) std::cout << std::setw(9) << std::fixed << std::setprecision(1) << t << " [ms]";
+        std::cout << '\n';
+    }
+
+    return 0;
+}
@@ -0,0 +1,95 @@
+/*
+  Minimum cost flow: successive shortest path vs. cost scaling on transportation networks
+  =======================================================================================
+  * Assumed input is a transportation problem (many sources and sinks with large supplies)
+
+  Comparing the execution time of MinimumCostFlow(s, t) (minimum cost maximum flow) in
+    1. SuccessiveShortestPath<T, U> in graph/minimum_cost_flow_successive_shortest_path.cc
+    2. CostScaling<T, U>            in graph/minimum_cost_flow_cost_scaling.cc
+
+  Input: s -> L (|L| = k), L -> R (|R| = k, d random customers for each supplier), R -> t.
+         Supplies (s -> L) and demands (R -> t) are uniformly random in [1, 1000],
+         capacities of L -> R are infinite and their costs are uniformly random in [1, 1000].
+         The time includes building the network.
+
+  My opinion
+    The successive shortest path algorithm runs Dijkstra's algorithm once per augmenting path
+    and the number of paths grows with k, so cost scaling is several times faster on large
+    networks. On small networks the two are close.
+
+  Result executed this code on my computer.
+    - OS : Debian GNU/Linux 12 (bookworm)
+    - Processor: Intel Xeon Processor (1 core)
+    - Compiler : gcc version 12.2.0 (-O2)
+  ==============================================================================
+                                         k = 100       k = 300      k = 1000
+  ==============================================================================
+  SuccessiveShortestPath (d = 10)  :      9.4 [ms]    103.3 [ms]   2100.3 [ms]
+  CostScaling            (d = 10)  :      7.5 [ms]     34.7 [ms]    384.9 [ms]
+  SuccessiveShortestPath (d = 100) :     23.7 [ms]    258.6 [ms]   4110.7 [ms]
+  CostScaling            (d = 100) :     21.8 [ms]    119.6 [ms]   1111.1 [ms]
+  ------------------------------------------------------------------------------
+*/
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <limits>
+#include <iomanip>
+#include <string>
+#include <tuple>
+
+//  @require ../graph/minimum_cost_flow_successive_shortest_path.cc 👇👇
+//  @require ../graph/minimum_cost_flow_cost_scaling.cc 👇👇
+
+using Arc = std::tuple<int, int, long long, long long>;
+
+template<class Algorithm>
+double Solve(const int n, const std::vector<Arc> &arcs, std::pair<long long, long long> &res) {
+    namespace cn = std::chrono;
+    const auto start = cn::high_resolution_clock::now();
+    Algorithm g(n);
+    for (const auto &a : arcs) g.add_arc(std::get<0>(a), std::get<1>(a), std::get<2>(a), std::get<3>(a));
+    res = g.MinimumCostFlow(n - 2, n - 1);
+    const auto end = cn::high_resolution_clock::now();
+    return cn::duration_cast<cn::microseconds>(end - start).count() / 1000.0;
+}
+
+int main() {
+    std::mt19937 rng(0);
+    const std::vector<std::string> name = {
+        "SuccessiveShortestPath (d = 10) ",
+        "CostScaling            (d = 10) ",
+        "SuccessiveShortestPath (d = 100)",
+        "CostScaling            (d = 100)",
+    };
+    const long long INF = std::numeric_limits<long long>::max() / 10;
+
+    std::vector<std::vector<double>> res(name.size());
+    for (const int k : {100, 300, 1000}) {
+        const int n = 2 * k + 2, s = n - 2, t = n - 1;
+        for (int type = 0; type < 2; ++type) {
+            const int d = (type == 0 ? 10 : 100);
+            std::vector<Arc> arcs;
+            for (int i = 0; i < k; ++i) arcs.emplace_back(s, i, rng() % 1000 + 1, 0);
+            for (int i = 0; i < k; ++i)
+                for (int j = 0; j < d; ++j) arcs.emplace_back(i, k + rng() % k, INF, rng() % 1000 + 1);
+            for (int j = 0; j < k; ++j) arcs.emplace_back(k + j, t, rng() % 1000 + 1, 0);
+
+            std::pair<long long, long long> r1, r2;
+            res[2 * type].push_back(Solve<SuccessiveShortestPath<long long, long long>>(n, arcs, r1));
+            res[2 * type + 1].push_back(Solve<CostScaling<long long, long long>>(n, arcs, r2));
+            if (r1 != r2) std::cerr << "wrong answer" << std::endl;
+        }
+    }
+
+    std::cout << "                                         k = 100       k = 300      k = 1000\n";
+    for (std::size_t i = 0; i < name.size(); ++i) {
+        std::cout << "  " << name[i] << " :";
+        for (auto t : res[i]) std::cout << std::setw(9) << std::fixed << std::setprecision(1) << t << " [ms]";
+        std::cout << '\n';
+    }
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+/*
+  Strongly connected components: Kosaraju vs. Pearce vs. parallel Forward-Backward
+  ================================================================================
+  * Assumed input is a large sparse digraph with a giant strongly connected component
+
+  Comparing the execution time of StronglyConnectedComponents() in
+    1. graph/strongly_connected_component_kosaraju.cc (recursive, adjacency list and its reverse)
+    2. graph/strongly_connected_component_pearce.cc   (iterative one pass, CSR)
+    3. graph/strongly_connected_component_parallel.cc (trimming + Forward-Backward, CSR, 1 thread)
+
+  Input: n vertices and m = 4n uniformly random arcs (about 98% of the vertices belong to one
+         strongly connected component and the rest are trimmed). The time to build the graph
+         is excluded, but 3. includes building the reverse graph.
+  "-" means the recursive version overflows the default 8 MB stack, so it is not measured.
+
+  Result executed this code on my computer.
+    - OS : Debian GNU/Linux 12 (bookworm)
+    - Processor: Intel Xeon Processor (1 core)
+    - Compiler : gcc version 12.2.0 (-O2)
+  (only 1 core is available, so 3. is not faster than 2. here; the speedup of 3. comes from
+   the parallel trimming and the parallel BFS of the giant component on multi-core machines)
+  ==============================================================================
+                          n = 10^5         n = 10^6         n = 10^7
+  ==============================================================================
+  Kosaraju (recursive) :        32.5 [ms]                -                -
+  Pearce (iterative)   :        11.2 [ms]       287.4 [ms]      6397.1 [ms]
+  Forward-Backward     :        30.9 [ms]       436.6 [ms]      8699.4 [ms]
+  ------------------------------------------------------------------------------
+*/
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <string>
+
+namespace kosaraju {
+//  @require ../graph/strongly_connected_component_kosaraju.cc 👇👇
+}
+
+//  @require ../graph/strongly_connected_component_pearce.cc 👇👇
+//  @require ../graph/strongly_connected_component_parallel.cc 👇👇
+
+template<class F>
+double Measure(F f) {
+    namespace cn = std::chrono;
+    const auto start = cn::high_resolution_clock::now();
+    f();
+    const auto end = cn::high_resolution_clock::now();
+    return cn::duration_cast<cn::microseconds>(end - start).count() / 1000.0;
+}
+
+int main() {
+    std::mt19937 rng(0);
+    const std::vector<std::string> name = {
+        "Kosaraju (recursive)",
+        "Pearce (iterative)  ",
+        "Forward-Backward    ",
+    };
+
+    std::vector<std::vector<double>> res(name.size());
+    for (const int n : {100000, 1000000, 10000000}) {
+        std::vector<std::pair<int, int>> arcs(4 * n);
+        for (auto &a : arcs) a = {int(rng() % n), int(rng() % n)};
+
+        int num[3] = {-1, -1, -1};
+        if (n <= 100000) {
+            kosaraju::Graph g(n);
+            for (auto a : arcs) g.add_arc(a.first, a.second);
+            res[0].push_back(Measure([&]() { num[0] = g.StronglyConnectedComponents(); }));
+        }
+        else res[0].push_back(-1);
+
+        CsrGraph<> g(n);
+        for (auto a : arcs) g.add_arc(a.first, a.second);
+        g.build();
+        res[1].push_back(Measure([&]() { PearceScc<> sc(g); num[1] = sc.StronglyConnectedComponents(); }));
+        res[2].push_back(Measure([&]() { ParallelScc<> sc(g); num[2] = sc.StronglyConnectedComponents(); }));
+        if ((num[0] != -1 && num[0] != num[1]) || num[1] != num[2]) std::cerr << "wrong answer" << std::endl;
+    }
+
+    std::cout << "                        n = 10^5         n = 10^6         n = 10^7\n";
+    for (std::size_t i = 0; i < name.size(); ++i) {
+        std::cout << "  " << name[i] << " :";
+        for (auto t : res[i]) {
+            if (t < 0) std::cout << std::setw(17) << "-";
+            else std::cout << std::setw(12) << std::fixed << std::setprecision(1) << t << " [ms]";
+        }
+        std::cout << '\n';
+    }
+
+    return 0;
+}
@@ -4,18 +4,21 @@
   ==========================================================================
 
   # Problem
-    Input: 有向グラフ G = (V, E), 弧重み w : E -> {0, 1}, 始点 s
+    Input: 有向グラフ G = (V, E), 弧重み w : E -> {0, 1}（DialBfs では {0, 1, ..., K}）, 始点 s
     Output: s から各頂点 v への最短距離 d[v]
 
-  # Complexity (n = |V|, m = |E|)
-    Time: O(n + m)
-    Memory: O(n + m)
+  # Complexity (n = |V|, m = |E|, L = s からの最短距離の最大値 <= (n - 1) K)
+    Time: O(n + m)（DialBfs では O(n + m + L)）
+    Memory: O(n + m)（DialBfs では O(n + m + K)）
 
   # Usage
     - Graph<T> g(n, s): 弧重みの型T，頂点数 n, 始点 s のグラフを構築．
                         2点間最短距離で終点 t が決まっている場合は g(n, s, t) とする
     - g.add_edge(u, v, w): 重み w の弧 (u, v) を追加
     - g.BinaryBfs(): 0-1 BFS を行う
+    - g.DialBfs(): 弧重みが 0 以上 K 以下の整数のときに Dial のアルゴリズムで最短距離を求める
+      （K は追加した弧重みの最大値）
+    - g.ChangeSource(s): 始点を変更して再度 DialBfs を行う（バケットの領域は再利用される）
     - g.distance(t): s から t への最短距離を返す. 経路が存在しない場合は INF を返す
 
   # Description
@@ -25,9 +28,25 @@
     デックとは先頭と末尾の要素へのアクセス・削除・追加が O(1)時間で可能なデータ構造である．
     基本的には幅優先探索を行うが，重み 0 の弧はデックの先頭に追加して，重み 1 の弧はデックの末尾に追加する．
 
+    弧重みが 0 以上 K 以下の整数の場合は Dial のアルゴリズムを用いる．暫定距離が c の頂点を
+    バケット c に入れて，c の小さい順にバケットを処理する．処理中のバケットが c のとき，
+    キューに入っている頂点の暫定距離は c 以上 c + K 以下なので，K + 1 個のバケットを
+    循環させて使えばよい（バケット c mod (K + 1)）．重み 0 の弧で到達した頂点は処理中の
+    バケットの末尾に追加されるので，バケットは添字で走査する．
+    暫定距離が真に小さくなったときだけバケットに追加するので，同じ頂点が複数回入っていても
+    距離が一致するのは1つだけであり，それ以外は取り出したときに読み飛ばす．
+    K = 1 のときはデックを使う 0-1 BFS と同じ順序で頂点を処理する．
+    std::deque はブロック単位で領域を確保するが，ここでは各バケットを std::vector として
+    呼び出しの間で領域を再利用している．
+
+  # Note
+    - 比較は compare_speed_cpp/01bfs.cc を参照
+
   # References
     - [保坂和宏，グラフ探索アルゴリズムとその応用]
       (http://hos.ac/slides/20110504_graph.pdf#page=50)
+    - R. B. Dial (1969): Algorithm 360: Shortest-path forest with topological ordering.
+      Communications of the ACM, 12(11), pp. 632--633.
 
   # Verified
     - [AtCoder Beginner Contest 077 D - Small Multple]
@@ -38,6 +57,7 @@
 #include <vector>
 #include <limits>
 #include <deque>
+#include <algorithm>
 
 // -------------8<------- start of library -------8<------------------------
 template<class T>
@@ -45,15 +65,24 @@ struct Graph {
     const T INF = std::numeric_limits<T>::max();
     const int n;
     int s, t;
-    std::vector<std::vector<std::pair<int, int>>> adj;
+    T max_w = 0;
+    std::vector<std::vector<std::pair<int, T>>> adj;
     std::vector<T> d;
+    std::vector<std::vector<int>> bucket;
 
     Graph(int _n, int _s, int _t = -1)
         : n(_n), s(_s), t(_t), adj(n), d(n, INF) { }
 
-    void add_edge(int u, int v, T w) { adj[u].emplace_back(std::make_pair(v, w)); }
+    void add_edge(int u, int v, T w) {
+        adj[u].emplace_back(v, w);
+        max_w = std::max(max_w, w);
+    }
     T distance(const int _t) const { return d[_t]; }
 
+    void ChangeSource(const int _s) {
+        s = _s; std::fill(d.begin(), d.end(), INF); DialBfs();
+    }
+
     void BinaryBfs() {
         std::deque<int> deq;
         d[s] = 0; deq.push_front(s);
@@ -70,6 +99,32 @@ struct Graph {
             }
         }
     }
+
+    void DialBfs() {
+        const std::size_t K = max_w;
+        bucket.resize(K + 1);
+        for (auto &b : bucket) b.clear();
+
+        d[s] = 0; bucket[0].push_back(s);
+        std::size_t remain = 1;
+        for (T c = 0; 0 < remain; ++c) {
+            auto &b = bucket[c % (K + 1)];
+            for (std::size_t i = 0; i < b.size(); ++i) {
+                const int cur = b[i];
+                if (d[cur] != c) continue;
+                if (cur == t) return;
+                for (const auto &e : adj[cur]) {
+                    if (c + e.second < d[e.first]) {
+                        d[e.first] = c + e.second;
+                        bucket[d[e.first] % (K + 1)].push_back(e.first);
+                        ++remain;
+                    }
+                }
+            }
+            remain -= b.size();
+            b.clear();
+        }
+    }
 };
 // -------------8<------- end of library ---------8-------------------------
 
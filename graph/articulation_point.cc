@@ -39,6 +39,11 @@
 
     2点連結成分は UnionFind で端点に関節点を含まない辺の端点を連結すると得られる．
 
+  # Note
+    - Dfs は再帰なので深さの大きいグラフ（パスに近いグラフ）ではスタックが溢れる．
+      その場合は明示的なスタックを使う graph/lowlink.cc を使う
+    - 複数スレッドで並列に分解する場合は graph/biconnected_component_parallel.cc を使う
+
   # References
     - [保坂和宏，グラフ探索アルゴリズムとその応用](http://hos.ac/slides/20110504_graph.pdf)
 
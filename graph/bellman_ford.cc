@@ -8,7 +8,7 @@
     Output: s から各頂点 v への最短距離 d[v]
 
   # Complexity (n = |V|, m = |E|)
-    Time: O(n * m)
+    Time: O(n * m)（Spfa も最悪の場合は同じ）
     Memory: O(n + m)
 
   # Usage
@@ -19,6 +19,7 @@
     - g.distance(t): src から t への最短距離を返す. g.INF と等しい場合は最短距離は存在しない
     - g.IsNegativeCycle(): src から到達可能な負閉路が存在するとき true を返す
 
+    - g.Spfa(): キューを使ったベルマン・フォード法（SPFA）で最短距離を求める（BellmanFord と同じ結果）
     - g.CheckNegativeCycle(): g に負閉路が存在するか判定する（d は最短距離とは限らない値となる）
 
   # Note
@@ -29,9 +30,21 @@
     - src からある頂点 v への最短距離が有界かどうかを判定するには，ベルマン・フォード法を実行した後に，
       再度 n 回ループを回す．このとき，更新されるすべての頂点の最短距離は有界ではない．
       (cf. AtCoder Beginner Contest 061 D - Score Attack)
+    - 負の弧重みが存在しない大きなグラフでは並列化した delta_stepping.cc を使用する
+
+  # Description
+    BellmanFord は毎回すべての弧を調べるが，d[u] が前回の反復から変化していない頂点 u から
+    出る弧では d[v] が更新されることはない．Spfa（Shortest Path Faster Algorithm）は
+    d が更新された頂点だけをキューに入れて，その頂点から出る弧だけを調べる．
+    また，s から v への暫定の最短路の弧数 len[v] を記録して，len[v] >= n となったら
+    その時点で負閉路が存在すると判定して打ち切る（n 回目の反復まで待つ必要がない）．
+    キューの初期状態は d[v] < INF のすべての頂点なので，CheckNegativeCycle のように
+    すべての d[v] = 0 とすると G 全体の負閉路を検出できる．
 
   # References
     - あり本 pp. 95--96
+    - [Wikipedia: Shortest Path Faster Algorithm]
+      (https://en.wikipedia.org/wiki/Shortest_Path_Faster_Algorithm)
 
   # Verified
     - [AOJ Shortest Path - Single Source Shortest Path (Negative Edges)]
@@ -41,6 +54,7 @@
 #include <iostream>
 #include <vector>
 #include <limits>
+#include <queue>
 
 // -------------8<------- start of library -------8<------------------------
 template<class T>
@@ -60,7 +74,7 @@ struct Graph {
 
     bool CheckNegativeCycle() {
         std::fill(d.begin(), d.end(), 0);
-        BellmanFord();
+        Spfa();
         return is_neg_cycle;
     }
 
@@ -78,6 +92,27 @@ struct Graph {
             if (i == n - 1) { is_neg_cycle = true; break; }
         }
     }
+
+    void Spfa() {
+        d[src] = 0;
+        std::vector<int> len(n, 0);
+        std::vector<char> in_que(n, false);
+        std::queue<int> que;
+        for (int v = 0; v < n; ++v)
+            if (d[v] < INF) { que.push(v); in_que[v] = true; }
+
+        while (!que.empty()) {
+            const int v = que.front(); que.pop();
+            in_que[v] = false;
+            for (const auto &e : adj[v])
+                if (d[v] + e.second < d[e.first]) {
+                    d[e.first] = d[v] + e.second;
+                    len[e.first] = len[v] + 1;
+                    if (n <= len[e.first]) { is_neg_cycle = true; return; }
+                    if (!in_que[e.first]) { que.push(e.first); in_que[e.first] = true; }
+                }
+        }
+    }
 };
 // -------------8<------- end of library ---------8-------------------------
 
@@ -0,0 +1,240 @@
+/*
+  Breadth First Search (direction-optimizing, multithreaded)
+  幅優先探索（方向最適化，並列化）
+  ==========================================================
+
+  # Problem
+    Input: 有向グラフ G = (V, E), 始点 s
+    Output: s から各頂点 v への最短距離（辺数）d[v] と BFS 木の親 parent[v]
+
+  # Complexity (n = |V|, m = |E|, D = s から到達可能な頂点の離心率, p = スレッド数)
+    Time: O(n + m)（bottom-up のステップは O(n / 64 + 調べた弧の数)．合計で最悪 O(D n / 64 + m)）
+    Memory: O(n + m)
+
+  # Usage
+    - CsrGraph<T> g(n): 頂点数 n のグラフ（graph/csr_graph.cc）
+    - g.add_edge(u, v), g.build(): 辺を追加して隣接配列を構築
+    - DirectionOptimizingBfs<T> bfs(g, p): 無向グラフ g に対する p スレッドの BFS
+      （p を省略するとコア数）
+    - DirectionOptimizingBfs<T> bfs(g, rg, p): 有向グラフ g と逆向きのグラフ rg = g.reverse()
+      に対する BFS（bottom-up のステップでは入ってくる弧を調べるので rg が必要）
+    - bfs.Run(s): s からの BFS を行う
+    - bfs.RunAll(): すべての頂点を順に始点として，まだ訪れていない頂点から BFS を行う（BFS 森）
+    - bfs.dist[v]: 始点から v への最短距離．到達不可能な場合は bfs.INF
+    - bfs.parent[v]: BFS 木での v の親（始点では v 自身，到達不可能な場合は -1）
+
+  # Description
+    通常の BFS（top-down）は現在のフロンティアの頂点から出る弧をすべて調べて，未訪問の頂点を
+    次のフロンティアに加える．フロンティアが大きくなると，調べた弧の大部分は訪問済みの頂点への
+    弧となって無駄が多い．bottom-up のステップでは逆に未訪問の頂点 v ごとに入ってくる弧を調べ，
+    フロンティアの頂点が1つ見つかった時点でその頂点を親として打ち切る．
+    直径の小さいグラフ（ソーシャルネットワーク等）では中間の数レベルでフロンティアが
+    グラフの大部分を占めるので，この切り替えで調べる弧の数が大きく減る．
+
+    切り替えは Beamer らのヒューリスティックに従う．フロンティアの頂点の次数の和を m_f，
+    未訪問の頂点の次数の和を m_u として
+      - top-down -> bottom-up: m_f > m_u / ALPHA
+      - bottom-up -> top-down: フロンティアの頂点数 n_f が減少していて n_f < n / BETA
+    bottom-up のときはフロンティアと訪問済みの集合を 64 bit ワードのビット列で表す．
+
+    並列化は次のように行う．
+      - top-down: フロンティアの頂点をスレッドに分割する．訪問済みのビットを fetch_or で
+        立てたスレッドだけが parent と dist を書き込み，スレッドごとの配列に追加する
+      - bottom-up: ビット列のワード（64頂点）単位でスレッドに分割する．各スレッドは自分の
+        ワードにだけ書き込むので，同期はステップの終わりだけでよい
+
+  # Note
+    - フロンティアの弧の数が PARALLEL_THRESHOLD より少ないステップは逐次で処理する
+    - ステップごとに std::thread を生成する
+    - 並列に実行した場合は parent はスレッドの実行順序に依存する（dist は一意）
+    - 直径の大きいグラフ（木やグリッド）では bottom-up にはほとんど切り替わらない
+
+  # References
+    - S. Beamer, K. Asanović, and D. Patterson (2012): Direction-optimizing breadth-first search.
+      In Proceedings of SC '12, pp. 1--10.
+*/
+
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+
+//  @require ./csr_graph.cc 👇👇
+
+// -------------8<------- start of library -------8<------------------------
+template<class T = int>
+struct DirectionOptimizingBfs {
+    using Word = unsigned long long;
+    static constexpr int ALPHA = 15, BETA = 18;
+    static constexpr int PARALLEL_THRESHOLD = 1 << 14;
+    const int INF = std::numeric_limits<int>::max();
+    const CsrGraph<T> &g, &rg;
+    const int n, p;
+    std::vector<int> dist, parent;
+
+    explicit DirectionOptimizingBfs(const CsrGraph<T> &_g,
+                                    int _p = std::max(1u, std::thread::hardware_concurrency()))
+        : DirectionOptimizingBfs(_g, _g, _p) {}
+
+    DirectionOptimizingBfs(const CsrGraph<T> &_g, const CsrGraph<T> &_rg,
+                           int _p = std::max(1u, std::thread::hardware_concurrency()))
+        : g(_g), rg(_rg), n(g.n), p(_p), dist(n, INF), parent(n, -1),
+          visited((n + 63) / 64), front(visited.size()), next(visited.size()), local(p) {}
+
+    void Run(const int s) { Reset(); Search(s); }
+
+    void RunAll() {
+        Reset();
+        for (int v = 0; v < n; ++v)
+            if (parent[v] == -1) Search(v);
+    }
+
+private:
+    std::vector<std::atomic<Word>> visited;
+    std::vector<Word> front, next;
+    std::vector<int> queue;
+    std::vector<std::vector<int>> local;
+    long long unexplored;  // sum of the degrees of unvisited vertices
+
+    void Reset() {
+        std::fill(dist.begin(), dist.end(), INF);
+        std::fill(parent.begin(), parent.end(), -1);
+        for (auto &w : visited) w.store(0, std::memory_order_relaxed);
+        unexplored = g.num_arcs();
+    }
+
+    bool IsVisited(const int v) const {
+        return visited[v >> 6].load(std::memory_order_relaxed) >> (v & 63) & 1;
+    }
+
+    void Search(const int s) {
+        visited[s >> 6].fetch_or(Word(1) << (s & 63));
+        dist[s] = 0; parent[s] = s;
+        unexplored -= g.degree(s);
+        queue.assign(1, s);
+
+        long long scout = g.degree(s);
+        int size = 1, prev_size = 0;
+        bool bottom_up = false;
+        for (int level = 1; 0 < size; ++level) {
+            if (!bottom_up && unexplored < scout * ALPHA) {
+                std::fill(front.begin(), front.end(), 0);
+                for (int v : queue) front[v >> 6] |= Word(1) << (v & 63);
+                bottom_up = true;
+            }
+            else if (bottom_up && size < prev_size && (long long)size * BETA < n) {
+                queue.clear();
+                for (int w = 0; w < (int)front.size(); ++w)
+                    for (Word x = front[w]; x; x &= x - 1) queue.push_back(w * 64 + __builtin_ctzll(x));
+                bottom_up = false;
+            }
+
+            prev_size = size;
+            if (bottom_up) scout = BottomUpStep(level, size);
+            else scout = TopDownStep(level, size);
+            unexplored -= scout;
+        }
+    }
+
+    // returns the sum of the degrees of the new frontier
+    long long TopDownStep(const int level, int &size) {
+        std::vector<long long> sum(p, 0);
+        auto work = [&](const int tid, const int lo, const int hi) {
+            for (int k = lo; k < hi; ++k) {
+                const int v = queue[k];
+                for (int u : g.adj(v)) {
+                    const Word bit = Word(1) << (u & 63);
+                    if (visited[u >> 6].load(std::memory_order_relaxed) & bit) continue;
+                    if (visited[u >> 6].fetch_or(bit) & bit) continue;
+                    dist[u] = level; parent[u] = v;
+                    local[tid].push_back(u);
+                    sum[tid] += g.degree(u);
+                }
+            }
+        };
+        long long arcs = 0;
+        for (int v : queue) arcs += g.degree(v);
+        Parallel(queue.size(), arcs, work);
+
+        queue.clear();
+        for (auto &l : local) { queue.insert(queue.end(), l.begin(), l.end()); l.clear(); }
+        size = queue.size();
+        long long res = 0;
+        for (auto x : sum) res += x;
+        return res;
+    }
+
+    long long BottomUpStep(const int level, int &size) {
+        std::vector<long long> sum(p, 0);
+        std::vector<int> cnt(p, 0);
+        auto work = [&](const int tid, const int lo, const int hi) {
+            for (int w = lo; w < hi; ++w) {
+                const Word vis = visited[w].load(std::memory_order_relaxed);
+                Word nxt = 0;
+                const int last = std::min(64, n - w * 64);
+                for (int b = 0; b < last; ++b) {
+                    if (vis >> b & 1) continue;
+                    const int v = w * 64 + b;
+                    for (int u : rg.adj(v)) {
+                        if (!(front[u >> 6] >> (u & 63) & 1)) continue;
+                        dist[v] = level; parent[v] = u;
+                        nxt |= Word(1) << b;
+                        sum[tid] += g.degree(v);
+                        ++cnt[tid];
+                        break;
+                    }
+                }
+                next[w] = nxt;
+                if (nxt) visited[w].store(vis | nxt, std::memory_order_relaxed);
+            }
+        };
+        Parallel(front.size(), unexplored, work);
+
+        front.swap(next);
+        size = 0;
+        long long res = 0;
+        for (int t = 0; t < p; ++t) { size += cnt[t]; res += sum[t]; }
+        return res;
+    }
+
+    // splits [0, tasks) into p contiguous ranges when the work is large enough
+    template<class F>
+    void Parallel(const int tasks, const long long work, F f) {
+        if (p == 1 || work < PARALLEL_THRESHOLD) { f(0, 0, tasks); return; }
+        std::vector<std::thread> th;
+        const int chunk = (tasks + p - 1) / p;
+        for (int t = 1; t < p; ++t)
+            th.emplace_back(f, t, std::min(tasks, t * chunk), std::min(tasks, (t + 1) * chunk));
+        f(0, 0, std::min(tasks, chunk));
+        for (auto &t : th) t.join();
+    }
+};
+// -------------8<------- end of library ---------8-------------------------
+
+int main() {
+    std::cin.tie(0); std::ios::sync_with_stdio(false);
+
+    // AOJ ALDS1_11_C: Breadth First Search
+    int n;
+    std::cin >> n;
+
+    CsrGraph<> g(n);
+    for (int i = 0, u, k; i < n; ++i) {
+        std::cin >> u >> k;
+        for (int j = 0, v; j < k; ++j) {
+            std::cin >> v;
+            g.add_arc(u - 1, v - 1);
+        }
+    }
+    g.build();
+    const auto rg = g.reverse();
+
+    DirectionOptimizingBfs<> bfs(g, rg);
+    bfs.Run(0);
+    for (int v = 0; v < n; ++v)
+        std::cout << v + 1 << ' ' << (bfs.dist[v] == bfs.INF ? -1 : bfs.dist[v]) << '\n';
+
+    return 0;
+}
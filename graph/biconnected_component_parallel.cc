@@ -0,0 +1,256 @@
+/*
+  2-vertex connected components in parallel (Tarjan and Vishkin)
+  並列化した2点連結成分分解（Tarjan-Vishkin のアルゴリズム）
+  ==============================================================
+
+  # Problem
+    Input: 無向グラフ G = (V, E)（多重辺・自己ループがあってもよい）
+    Output: G のすべての関節点と2点連結成分（辺の分割）
+
+    Def. 関節点(articulation point), 2点連結成分 -> graph/articulation_point.cc
+
+  # Complexity (n = |V|, m = |E|, p = スレッド数, D = BFS 木の高さ)
+    Time: O((n + m) α(n) / p + D + n)（O(n) の部分は木の構築などの逐次処理で，定数は小さい）
+    Memory: O(n + m)
+
+  # Usage
+    - CsrGraph<T> g(n): 頂点数 n のグラフ（graph/csr_graph.cc）
+    - g.add_edge(u, v), g.build(): 辺 {u, v} を追加して隣接配列を構築（辺番号は追加した順番）
+    - ParallelBiconnectivity<T> bc(g, p): p スレッドで g を2点連結成分分解する
+      （p を省略するとコア数）
+    - bc.ArticulationPoints(): 関節点の数を返す
+      + bc.art: 関節点を昇順に並べたもの, bc.is_art[v]: 頂点 v が関節点かどうか
+    - bc.BiconnectedComponent(): 2点連結成分の数を返す
+      + bc.vcomp[e]: 辺 e が属する2点連結成分の番号（自己ループは -1）
+    - 結果は graph/lowlink.cc の Lowlink<T> と（成分の番号の付け替えを除いて）一致する
+
+  # Description
+    DFS は本質的に逐次的なので，Tarjan と Vishkin は任意の全域木から補助グラフを作り，
+    その連結成分として2点連結成分を求めた．ここでは次の手順で行う．
+      1. 方向最適化 BFS（graph/bfs_direction_optimizing.cc）で全域森 F を求める．
+         各頂点 v ≠ 根について親への辺 e_v を1本選ぶ（多重辺は辺番号の最小のもの）
+      2. F の各頂点の部分木の大きさ size[v] と行きがけ順 pre[v] を求める．
+         BFS の深さごとに，size は深い方から，pre は浅い方から並列に計算する
+         （Euler tour を使う方法と同じ値になる）
+      3. low[v] = min({pre[v]} ∪ {pre[w] : 非木辺 {u, w}, u は v の部分木の頂点})，
+         high[v] も同様に最大値として，深さごとに深い方から並列に集約する
+      4. 木の辺 e_v を頂点とする補助グラフを作り，並行 union-find で連結成分を求める
+         (a) 非木辺 {u, w} で u と w が祖先・子孫の関係にないとき e_u と e_w を結ぶ
+         (b) 木の辺 e_v（親 p は根ではない）で low[v] < pre[p] または
+             high[v] >= pre[p] + size[p] のとき e_v と e_p を結ぶ
+      5. 非木辺 {u, w}（pre[u] > pre[w]）は e_u と同じ成分に属する．
+         頂点 v は接続する辺が2つ以上の成分に属するとき関節点である
+    1 以外の各ステップは頂点または弧ごとに独立なので並列に処理する．union-find は
+    compare-and-swap で親を書き換え，番号の大きい根を小さい根の下につなぐ（閉路ができない）．
+    成分の代表元は成分内で番号最小の頂点になるので，結果はスレッド数によらない．
+
+  # Note
+    - 頂点数が PARALLEL_THRESHOLD より少ない処理は逐次で行う
+    - ステップごとに std::thread を生成する
+    - 深さごとの処理は BFS 木の高さ D の回数だけ同期するので，直径の大きいグラフでは
+      graph/lowlink.cc の方が速い
+
+  # References
+    - R. E. Tarjan and U. Vishkin (1985): An efficient parallel biconnectivity algorithm.
+      SIAM Journal on Computing, 14(4), pp. 862--874.
+    - R. J. Anderson and H. Woll (1991): Wait-free parallel algorithms for the union-find
+      problem. In Proceedings of STOC '91, pp. 370--380.
+
+  # Verified
+    - graph/lowlink.cc とランダムグラフ上で比較
+*/
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+
+//  @require ./csr_graph.cc 👇👇
+//  @require ./bfs_direction_optimizing.cc 👇👇
+
+// -------------8<------- start of library -------8<------------------------
+template<class T = int>
+struct ParallelBiconnectivity {
+    static constexpr int PARALLEL_THRESHOLD = 1 << 14;
+    const CsrGraph<T> &g;
+    const int n, p;
+    std::vector<int> art, vcomp;
+    std::vector<char> is_art;
+
+    explicit ParallelBiconnectivity(const CsrGraph<T> &_g,
+                                    int _p = std::max(1u, std::thread::hardware_concurrency()))
+        : g(_g), n(g.n), p(_p), vcomp(g.m, -1), is_art(n, false),
+          pre(n), size(n, 1), low(n), high(n), pe(n, -1), uf(n) {
+        Solve();
+    }
+
+    int ArticulationPoints() const { return art.size(); }
+    int BiconnectedComponent() const { return num_vcomp; }
+
+private:
+    int num_vcomp = 0;
+    std::vector<int> parent, pre, size, low, high, pe;
+    std::vector<std::atomic<int>> uf;
+
+    bool IsAncestor(const int a, const int b) const { return pre[a] <= pre[b] && pre[b] < pre[a] + size[a]; }
+
+    void Solve() {
+        // 1. spanning forest
+        DirectionOptimizingBfs<T> bfs(g, p);
+        bfs.RunAll();
+        parent = bfs.parent;
+        Parallel(n, [&](int lo, int hi) {
+            for (int v = lo; v < hi; ++v) {
+                if (parent[v] == v) continue;
+                for (int i = g.head[v]; i < g.head[v + 1]; ++i)
+                    if (g.to[i] == parent[v] && (pe[v] == -1 || g.id[i] < pe[v])) pe[v] = g.id[i];
+            }
+        });
+
+        // vertices grouped by depth, and children in CSR form
+        int depth = 0;
+        for (int v = 0; v < n; ++v) depth = std::max(depth, bfs.dist[v] + 1);
+        std::vector<int> lhead(depth + 1, 0), layer(n), chead(n + 1, 0), child(n);
+        for (int v = 0; v < n; ++v) { ++lhead[bfs.dist[v] + 1]; if (parent[v] != v) ++chead[parent[v] + 1]; }
+        for (int d = 0; d < depth; ++d) lhead[d + 1] += lhead[d];
+        for (int v = 0; v < n; ++v) chead[v + 1] += chead[v];
+        {
+            std::vector<int> lpos(lhead.begin(), lhead.end() - 1), cpos(chead.begin(), chead.end() - 1);
+            for (int v = 0; v < n; ++v) {
+                layer[lpos[bfs.dist[v]]++] = v;
+                if (parent[v] != v) child[cpos[parent[v]]++] = v;
+            }
+        }
+        auto ForLayer = [&](const int d, auto f) {
+            Parallel(lhead[d + 1] - lhead[d], [&](int lo, int hi) {
+                for (int k = lhead[d] + lo; k < lhead[d] + hi; ++k) f(layer[k]);
+            });
+        };
+
+        // 2. subtree sizes (bottom-up) and preorder numbers (top-down)
+        for (int d = depth - 1; 0 <= d; --d)
+            ForLayer(d, [&](int v) {
+                for (int k = chead[v]; k < chead[v + 1]; ++k) size[v] += size[child[k]];
+            });
+        for (int v = 0, offset = 0; v < n; ++v)
+            if (parent[v] == v) { pre[v] = offset; offset += size[v]; }
+        for (int d = 0; d < depth; ++d)
+            ForLayer(d, [&](int v) {
+                int cur = pre[v] + 1;
+                for (int k = chead[v]; k < chead[v + 1]; ++k) { pre[child[k]] = cur; cur += size[child[k]]; }
+            });
+
+        // 3. low and high over subtrees
+        Parallel(n, [&](int lo, int hi) {
+            for (int v = lo; v < hi; ++v) {
+                low[v] = high[v] = pre[v];
+                for (int i = g.head[v]; i < g.head[v + 1]; ++i) {
+                    if (g.id[i] == pe[v] || (parent[g.to[i]] == v && pe[g.to[i]] == g.id[i])) continue;
+                    low[v] = std::min(low[v], pre[g.to[i]]);
+                    high[v] = std::max(high[v], pre[g.to[i]]);
+                }
+            }
+        });
+        for (int d = depth - 1; 0 <= d; --d)
+            ForLayer(d, [&](int v) {
+                for (int k = chead[v]; k < chead[v + 1]; ++k) {
+                    low[v] = std::min(low[v], low[child[k]]);
+                    high[v] = std::max(high[v], high[child[k]]);
+                }
+            });
+
+        // 4. connected components of the auxiliary graph (tree edge e_v is identified with v)
+        for (int v = 0; v < n; ++v) uf[v].store(v, std::memory_order_relaxed);
+        Parallel(n, [&](int lo, int hi) {
+            for (int v = lo; v < hi; ++v) {
+                if (parent[v] == v) continue;
+                for (int i = g.head[v]; i < g.head[v + 1]; ++i) {
+                    const int w = g.to[i];
+                    if (w == v || g.id[i] == pe[v] || pre[w] < pre[v]) continue;
+                    if (!IsAncestor(v, w) && !IsAncestor(w, v)) Unite(v, w);  // (a)
+                }
+                const int q = parent[v];
+                if (parent[q] != q && (low[v] < pre[q] || pre[q] + size[q] <= high[v])) Unite(v, q);  // (b)
+            }
+        });
+
+        // 5. edge labels and articulation points
+        std::vector<int> id(n, -1);
+        for (int v = 0; v < n; ++v)
+            if (parent[v] != v && Find(v) == v) id[v] = num_vcomp++;
+        Parallel(n, [&](int lo, int hi) {
+            for (int v = lo; v < hi; ++v)
+                for (int i = g.head[v]; i < g.head[v + 1]; ++i) {
+                    const int w = g.to[i];
+                    if (w == v || (g.id[i] != pe[v] && pre[v] < pre[w])) continue;
+                    vcomp[g.id[i]] = id[Find(v)];
+                }
+        });
+        Parallel(n, [&](int lo, int hi) {
+            for (int v = lo; v < hi; ++v) {
+                int c = -1;
+                for (int i = g.head[v]; i < g.head[v + 1]; ++i) {
+                    const int x = vcomp[g.id[i]];
+                    if (x == -1) continue;
+                    if (c == -1) c = x;
+                    else if (c != x) { is_art[v] = true; break; }
+                }
+            }
+        });
+        for (int v = 0; v < n; ++v) if (is_art[v]) art.push_back(v);
+    }
+
+    int Find(int x) {
+        while (true) {
+            int px = uf[x].load(std::memory_order_relaxed);
+            if (px == x) return x;
+            const int ppx = uf[px].load(std::memory_order_relaxed);
+            if (px != ppx) uf[x].compare_exchange_weak(px, ppx);  // path halving
+            x = ppx;
+        }
+    }
+
+    void Unite(int x, int y) {
+        while (true) {
+            x = Find(x); y = Find(y);
+            if (x == y) return;
+            if (x < y) std::swap(x, y);
+            int expected = x;
+            if (uf[x].compare_exchange_strong(expected, y)) return;
+        }
+    }
+
+    template<class F>
+    void Parallel(const int tasks, F f) {
+        if (p == 1 || tasks < PARALLEL_THRESHOLD) { f(0, tasks); return; }
+        std::vector<std::thread> th;
+        const int chunk = (tasks + p - 1) / p;
+        for (int t = 1; t < p; ++t)
+            th.emplace_back(f, std::min(tasks, t * chunk), std::min(tasks, (t + 1) * chunk));
+        f(0, std::min(tasks, chunk));
+        for (auto &t : th) t.join();
+    }
+};
+// -------------8<------- end of library ---------8-------------------------
+
+int main() {
+    std::cin.tie(0); std::ios::sync_with_stdio(false);
+
+    int n, m;
+    std::cin >> n >> m;
+
+    CsrGraph<> g(n);
+    for (int i = 0, u, v; i < m; ++i) {
+        std::cin >> u >> v;
+        g.add_edge(u, v);
+    }
+    g.build();
+
+    ParallelBiconnectivity<> bc(g);
+
+    // Output for AOJ GRL_3_A: Articulation Points
+    for (int v : bc.art) std::cout << v << '\n';
+
+    return 0;
+}
@@ -1,6 +1,6 @@
 /*
-  Maximum Bipartite Matching (using Ford-Fulkerson)
-  二部グラフの最大マッチング（フォード・ファルカーソン法を使用）
+  Maximum Bipartite Matching (Hopcroft-Karp)
+  二部グラフの最大マッチング（ホップクロフト・カープのアルゴリズム）
   =================================================
 
   # Problem
@@ -12,15 +12,42 @@
       サイズが最大となるマッチングを最大マッチングと呼ぶ
 
   # Complexity
-    Time : O(|V| * (|V| + |E|))
+    Time : O(|E| * sqrt(|V|))
     Space : O(|V| + |E|)
 
+  # Usage
+    - BipariteGraph g(L, R): A = [0, L), B = [0, R) の辺のない二部グラフを構築
+    - g.add_edge(a, b): 辺 {a, b} (a \in A, b \in B) を追加
+    - g.MaximumMatching(): 最大マッチングのサイズを返す
+    - g.Mate(a): A の頂点 a とマッチした B の頂点（マッチしていなければ -1）
+
   # Description
-    For-Fulkersonのように増加道をDfsで見つけてくる
+    For-Fulkersonのように増加道をDfsで1本ずつ見つけると O(|V| |E|) 時間かかる．
+    Hopcroft-Karp は次のフェーズを増加道がなくなるまで繰り返す．
+      1. A のマッチしていない頂点から幅優先探索を行い，交互道の長さで頂点を層に分ける．
+         マッチしていない B の頂点が見つかった層で打ち切る（最短の増加道の長さが決まる）
+      2. 層に沿った深さ優先探索で，最短の増加道で頂点素なものを極大になるまで見つけて
+         まとめて増加させる．行き止まりの頂点は層から外すので各辺は1回しか調べない
+    フェーズごとに最短の増加道の長さが増えるので，フェーズ数は O(sqrt(|V|))．
+
+    最初のマッチングは Karp-Sipser の貪欲法で作る．次数1の頂点があればその唯一の隣接頂点と
+    マッチさせ（この辺を含む最大マッチングが存在する），なければ残っている頂点を任意に
+    マッチさせる．疎なランダムグラフではこれだけでほぼ最大マッチングになる．
+
+    グラフは CSR 形式（graph/csr_graph.cc）で持ち，深さ優先探索はスタックを使って再帰しない．
+
+  # Note
+    - 頂点数・辺数が 10^6 を超えるグラフでも再帰が深くならない
+    - MaximumMatching を呼んだ後は辺を追加できない
+    - 比較は compare_speed_cpp/bipartite_maximum_matching.cc を参照
 
   # References
     [@tmaehara spagetthi-source/algorithm/graph/bipartite_matching]
     (https://github.com/spaghetti-source/algorithm/blob/master/graph/bipartite_matching.cc)
+    - J. E. Hopcroft and R. M. Karp (1973): An n^{5/2} algorithm for maximum matchings in
+      bipartite graphs. SIAM Journal on Computing, 2(4), pp. 225--231.
+    - R. M. Karp and M. Sipser (1981): Maximum matchings in sparse random graphs.
+      In Proceedings of FOCS 1981, pp. 364--375.
 
   # Verified
     [AOJ GRL_7_A Matching - Bipartite Matching]
@@ -29,23 +56,29 @@
 
 #include <iostream>
 #include <vector>
+#include <tuple>
+#include <cassert>
+
+//  @require ./csr_graph.cc 👇👇
 
 // -------------8<------- start of library -------8<------------------------
 class BipariteGraph {
 public:
     // Bipartite Graph G = (A; B, E), A = [0, L), B = [L, L + R)
     BipariteGraph(int _L, int _R)
-        : L(_L), R(_R), adj(L + R), match(L + R, -1), visited(L + R), size_match(0) {}
+        : L(_L), R(_R), g(L + R), match(L + R, -1), size_match(0) {}
 
     void add_edge(const int v1, const int v2) {
-        adj[v1].push_back(L + v2);
-        adj[L + v2].push_back(v1);
+        g.add_edge(v1, L + v2);
     }
 
+    int Mate(const int v) const { return match[v] < 0 ? -1 : match[v] - L; }
+
     int MaximumMatching() {
-        for (int v = 0; v < L; ++v) {
-            visited.assign(L + R, false);
-            if (Augment(v)) ++size_match;
+        if ((int)g.head.size() != L + R + 1) { g.build(); KarpSipser(); }
+        while (Layer()) {
+            for (int v = 0; v < L; ++v)
+                if (match[v] < 0 && dist[v] == 0 && Augment(v)) ++size_match;
         }
 
         /* もし解が必要ならばコメントアウト */
@@ -59,20 +92,80 @@ public:
 
 private:
     const int L, R;
-    std::vector<std::vector<int>> adj;
-    std::vector<int> match;
-    std::vector<char> visited; // vector<bool> is slow
-    int size_match;
-
-    bool Augment(const int cur) {
-        for (const int dst : adj[cur])
-            if (!visited[dst]) {
-                visited[dst] = true;
-                if (match[dst] < 0 || Augment(match[dst])) {
-                    match[cur] = dst; match[dst] = cur;
-                    return true;
-                }
+    CsrGraph<int> g;
+    std::vector<int> match, dist, iter, que, stk;
+    int size_match, limit;
+
+    void Match(const int a, const int b) { match[a] = b; match[b] = a; }
+
+    // greedy initial matching: a vertex of degree 1 is matched to its only neighbor first
+    void KarpSipser() {
+        std::vector<int> deg(L + R);
+        for (int v = 0; v < L + R; ++v) { deg[v] = g.degree(v); if (deg[v] == 1) que.push_back(v); }
+
+        auto remove = [&](const int v) {
+            for (const int u : g.adj(v))
+                if (match[u] < 0 && --deg[u] == 1) que.push_back(u);
+        };
+        auto free_neighbor = [&](const int v) {
+            for (const int u : g.adj(v)) if (match[u] < 0) return u;
+            return -1;
+        };
+
+        for (int v = 0; v < L + R; ++v) {
+            while (!que.empty()) {
+                const int x = que.back(); que.pop_back();
+                if (0 <= match[x]) continue;
+                const int y = free_neighbor(x);
+                if (y < 0) continue;
+                Match(x, y); ++size_match;
+                remove(x); remove(y);
             }
+            if (0 <= match[v]) continue;
+            const int u = free_neighbor(v);
+            if (u < 0) continue;
+            Match(v, u); ++size_match;
+            remove(v); remove(u);
+        }
+        que.clear();
+    }
+
+    // BFS from the free vertices of A; limit is the length of the shortest augmenting path
+    bool Layer() {
+        dist.assign(L, -1);
+        que.clear();
+        for (int v = 0; v < L; ++v)
+            if (match[v] < 0) { dist[v] = 0; que.push_back(v); }
+
+        limit = -1;
+        for (std::size_t k = 0; k < que.size(); ++k) {
+            const int v = que[k];
+            if (0 <= limit && limit <= dist[v]) break;
+            for (const int b : g.adj(v)) {
+                const int w = match[b];
+                if (w < 0) limit = dist[v] + 1;
+                else if (dist[w] < 0) { dist[w] = dist[v] + 1; que.push_back(w); }
+            }
+        }
+        iter.assign(g.head.begin(), g.head.begin() + L);
+        return 0 <= limit;
+    }
+
+    // finds a shortest augmenting path from s along the layers (without recursion)
+    bool Augment(const int s) {
+        stk.assign(1, s);
+        while (!stk.empty()) {
+            const int v = stk.back();
+            if (iter[v] == g.head[v + 1]) { dist[v] = -1; stk.pop_back(); continue; }
+            const int w = match[g.to[iter[v]]];
+            if (w < 0 && dist[v] + 1 == limit) {
+                // the vertices on the path are removed from the layers
+                for (const int u : stk) { Match(u, g.to[iter[u]]); dist[u] = -1; }
+                return true;
+            }
+            if (0 <= w && dist[w] == dist[v] + 1) stk.push_back(w);
+            else ++iter[v];
+        }
         return false;
     }
 };
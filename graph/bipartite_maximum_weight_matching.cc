@@ -0,0 +1,310 @@
+/*
+  Maximum Weight Bipartite Perfect Matching (Hungarian method / auction algorithm)
+  二部グラフの最大重み完全マッチング（ハンガリー法 / オークション法）
+  ================================================================================
+
+  # Problem
+    Input: 二部グラフ G = (A; B, E) (|A| <= |B|), 辺重み w : E -> Z
+    Output: A のすべての頂点がマッチする（A-完全な）マッチングで，重みの和が最大のもの
+
+    Def. マッチング(Matching) -> graph/bipartite_maximum_matching.cc
+
+  # Complexity (L = |A|, R = |B|, m = |E|, C = 辺重みの最大値 - 最小値)
+    Time :
+      + HungarianMatching: O(L^2 R)
+      + AuctionMatching: O(L m log(L C))（ただし実用上はこれよりずっと速い）
+    Space :
+      + HungarianMatching: O(L R)
+      + AuctionMatching: O(L + R + m)
+
+  # Usage
+    - HungarianMatching<T> g(L, R): A = [0, L), B = [0, R) (L <= R) の辺のない二部グラフを構築
+      （L * R の重み行列を確保する．密なグラフ向け）
+    - AuctionMatching<T> g(L, R, p): A = [0, L), B = [0, R) (L == R) の二部グラフを構築
+      （p スレッドで入札を計算する．p を省略するとコア数．疎なグラフ向け）
+    - g.add_edge(a, b, w): 重み w の辺 {a, b} (a \in A, b \in B) を追加
+    - g.MaximumWeightPerfectMatching(): A-完全なマッチングの重みの最大値を返す．
+      存在しなければ -g.INF を返す
+    - g.Mate(a): A の頂点 a とマッチした B の頂点
+
+  # Description
+    HungarianMatching は費用 c(a, b) = -w(a, b) の割当問題を Jonker-Volgenant 流の最短増加路法で解く．
+    B の頂点にポテンシャル v を持ち，A の頂点を1つずつ追加して，被約費用 c(a, b) - u(a) - v(b) >= 0
+    を距離とするダイクストラ法でマッチしていない B の頂点までの最短路を求めて増加させる．
+    L = R のときは最初に各列の最小値を v(b) として，最小値をとる行がまだマッチしていなければ
+    マッチさせる（列の縮約）．重み行列は1次元配列 c[a * R + b] に行優先で格納していて，
+    ダイクストラ法の各反復は行 c[a][*] による全列の緩和と最小値の探索になる．graph/dijkstra.cc と
+    同様に，どちらも分岐のないループに書いて（確定した列は done[b] で除外する）ベクトル化されるように
+    している．
+
+    AuctionMatching は Bertsekas のオークション法．A の頂点（入札者）は B の頂点（商品）の価格 p の
+    もとで利益 w(a, b) - p(b) が最大の商品に，2番目の利益との差 + ε だけ価格を上げて入札する．
+    商品は最高額の入札者に割り当てられて，前の持ち主は割当を失う．すべての入札者に商品が
+    割り当てられたとき，各入札者の利益は最大から ε 以内になっている（ε-相補性）．
+    重みを L + 1 倍した整数で ε = 1 まで ε を 1/ALPHA にしながら繰り返す（ε スケーリング）と最適解が求まる．
+    1ラウンドでは割当のない入札者全員の入札を独立に計算できるので（Jacobi 型），入札者を
+    スレッドに分割して並列に計算して，商品ごとの最高額を求めて割り当てるところは逐次に行う．
+    完全マッチングが存在しないと価格が上がり続けるので，最初に Hopcroft-Karp
+    （graph/bipartite_maximum_matching.cc）で完全マッチングの有無を調べる．
+
+  # Note
+    - 辺がない組は HungarianMatching では重み -INF として扱う．INF は T の最大値 / 4 なので，
+      重みの絶対値の和が INF / 2 を超えないように T を選ぶ（int の重みでも T = long long を推奨）
+    - 最小重みの場合は重みの符号を反転する
+    - AuctionMatching は重みを L + 1 倍するので T は整数型で，価格は O(L^2 C) の大きさになる
+    - AuctionMatching は |A| = |B| の場合のみ（|A| < |B| のときは重み 0 の辺だけを持つ A の頂点を追加する）
+    - 比較は compare_speed_cpp/bipartite_maximum_weight_matching.cc を参照
+
+  # References
+    - R. Jonker and A. Volgenant (1987): A shortest augmenting path algorithm for dense and
+      sparse linear assignment problems. Computing, 38(4), pp. 325--340.
+    - D. P. Bertsekas (1988): The auction algorithm: A distributed relaxation method for the
+      assignment problem. Annals of Operations Research, 14(1), pp. 105--123.
+    - D. P. Bertsekas and D. A. Castañon (1991): Parallel synchronous and asynchronous
+      implementations of the auction algorithm. Parallel Computing, 17(6-7), pp. 707--732.
+*/
+
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <thread>
+#include <tuple>
+#include <cassert>
+
+//  @require ./bipartite_maximum_matching.cc 👇👇
+
+// -------------8<------- start of library -------8<------------------------
+template<class T>
+class HungarianMatching {
+public:
+    const T INF = std::numeric_limits<T>::max() / 4;
+
+    // Bipartite Graph G = (A; B, E), A = [0, L), B = [0, R)
+    HungarianMatching(int _L, int _R)
+        : L(_L), R(_R), c((std::size_t)L * R, INF), col(L, -1) { assert(L <= R); }
+
+    void add_edge(const int a, const int b, const T w) {
+        T &x = c[(std::size_t)a * R + b];
+        x = std::min(x, -w);
+    }
+
+    int Mate(const int a) const { return col[a]; }
+
+    T MaximumWeightPerfectMatching() {
+        std::vector<T> v(R, 0), d(R), done(R);
+        std::vector<int> row(R, -1), pred(R), scanned;
+        T res = 0;
+        col.assign(L, -1);
+        if (L == R) ColumnReduction(v, row);
+        for (int s = 0; s < L; ++s) {
+            if (0 <= col[s]) continue;
+            const T *cs = &c[(std::size_t)s * R];
+            for (int b = 0; b < R; ++b) { d[b] = cs[b] - v[b]; pred[b] = s; }
+            std::fill(done.begin(), done.end(), std::numeric_limits<T>::lowest());
+            scanned.clear();
+
+            // Dijkstra's algorithm on the reduced costs until a free vertex of B is found
+            int j;
+            T mu;
+            while (true) {
+                j = ArgMin(d.data(), done.data(), R);
+                mu = d[j];
+                if (INF / 2 <= mu) return -INF;
+                done[j] = std::numeric_limits<T>::max();
+                if (row[j] < 0) break;
+                scanned.push_back(j);
+
+                const int i = row[j];
+                const T *ci = &c[(std::size_t)i * R];
+                const T h = mu - (ci[j] - v[j]);
+                T *dist = d.data();
+                int *pr = pred.data();
+                const T *vv = v.data();
+#pragma GCC ivdep
+                for (int b = 0, _R = R; b < _R; ++b) {
+                    const T x = h + ci[b] - vv[b];
+                    const bool lt = x < dist[b];
+                    dist[b] = lt ? x : dist[b];
+                    pr[b] = lt ? i : pr[b];
+                }
+            }
+
+            for (const int b : scanned) v[b] += d[b] - mu;
+            while (true) {
+                const int i = pred[j], k = col[i];
+                row[j] = i; col[i] = j;
+                if (i == s) break;
+                j = k;
+            }
+        }
+        for (int a = 0; a < L; ++a) res -= c[(std::size_t)a * R + col[a]];
+        return res;
+    }
+
+private:
+    const int L, R;
+    std::vector<T> c;  // c[a * R + b] = -w(a, b)
+    std::vector<int> col;
+
+    // v[b] = min_a c[a][b], and a is matched to b if it is the first minimum of a free row
+    void ColumnReduction(std::vector<T> &v, std::vector<int> &row) {
+        std::vector<int> arg(R, 0);
+        for (int b = 0; b < R; ++b) v[b] = c[b];
+        for (int a = 1; a < L; ++a) {
+            const T *ca = &c[(std::size_t)a * R];
+            T *vv = v.data();
+            int *ag = arg.data();
+#pragma GCC ivdep
+            for (int b = 0, _R = R; b < _R; ++b) {
+                const bool lt = ca[b] < vv[b];
+                vv[b] = lt ? ca[b] : vv[b];
+                ag[b] = lt ? a : ag[b];
+            }
+        }
+        for (int b = 0; b < R; ++b) {
+            if (INF <= v[b]) v[b] = 0;  // no edge
+            else if (col[arg[b]] < 0) { col[arg[b]] = b; row[b] = arg[b]; }
+        }
+    }
+
+    // argmin_b max(d[b], done[b]): minimum of each chunk (vectorized), then scan the best chunk
+    static int ArgMin(const T *d, const T *done, const int n) {
+        constexpr int CHUNK = 256;
+        T m = std::numeric_limits<T>::max();
+        int best = 0;
+        for (int b = 0; b < n; b += CHUNK) {
+            T cm = std::numeric_limits<T>::max();
+            for (int u = b, e = std::min(n, b + CHUNK); u < e; ++u) {
+                const T key = d[u] < done[u] ? done[u] : d[u];
+                cm = key < cm ? key : cm;
+            }
+            if (cm < m) { m = cm; best = b; }
+        }
+        for (int u = best; u < n; ++u)
+            if (std::max(d[u], done[u]) == m) return u;
+        return 0;
+    }
+};
+
+template<class T>
+class AuctionMatching {
+public:
+    static constexpr int ALPHA = 8, PARALLEL_THRESHOLD = 1024;
+    const T INF = std::numeric_limits<T>::max() / 4;
+
+    // Bipartite Graph G = (A; B, E), A = [0, L), B = [0, R)
+    AuctionMatching(int _L, int _R, int _p = std::max(1u, std::thread::hardware_concurrency()))
+        : L(_L), R(_R), p(_p), g(L) { assert(L == R); }
+
+    void add_edge(const int a, const int b, const T w) { g.add_arc(a, b, w); }
+
+    int Mate(const int a) const { return g.to[mate[a]]; }
+
+    T MaximumWeightPerfectMatching() {
+        if ((int)g.head.size() != L + 1) g.build();
+        BipariteGraph bg(L, R);
+        for (int a = 0; a < L; ++a)
+            for (const int b : g.adj(a)) bg.add_edge(a, b);
+        if (bg.MaximumMatching() < L) return -INF;
+        if (L == 0) return 0;
+
+        T wmin = g.weight[0], wmax = g.weight[0];
+        for (const T w : g.weight) { wmin = std::min(wmin, w); wmax = std::max(wmax, w); }
+        scale = L + 1;
+        range = (wmax - wmin) * scale + 1;
+        price.assign(R, 0);
+        for (T eps = std::max<T>(1, range / ALPHA); ; eps = std::max<T>(1, eps / ALPHA)) {
+            Phase(eps);
+            if (eps == 1) break;
+        }
+
+        T res = 0;
+        for (int a = 0; a < L; ++a) res += g.weight[mate[a]];
+        return res;
+    }
+
+private:
+    const int L, R, p;
+    CsrGraph<T> g;
+    T scale, range;
+    std::vector<T> price, bid, best;
+    std::vector<int> mate, owner, winner;  // mate[a]: position of the arc in g
+
+    void Phase(const T eps) {
+        mate.assign(L, -1); owner.assign(R, -1);
+        best.assign(R, std::numeric_limits<T>::lowest()); winner.assign(R, -1);
+        bid.resize(L);
+        std::vector<int> bidders(L), next, target(L), touched;
+        for (int a = 0; a < L; ++a) bidders[a] = a;
+
+        while (!bidders.empty()) {
+            // each bidder a bids for the arc target[a] (in parallel)
+            auto work = [&](std::size_t lo, std::size_t hi) {
+                for (std::size_t k = lo; k < hi; ++k) {
+                    const int a = bidders[k];
+                    T v1 = std::numeric_limits<T>::lowest(), v2 = v1;
+                    int i1 = -1;
+                    for (int i = g.head[a]; i < g.head[a + 1]; ++i) {
+                        const T val = g.weight[i] * scale - price[g.to[i]];
+                        if (v1 < val) { v2 = v1; v1 = val; i1 = i; }
+                        else if (v2 < val) v2 = val;
+                    }
+                    target[a] = i1;
+                    const T gap = (v2 == std::numeric_limits<T>::lowest() ? range : std::min(v1 - v2, range));
+                    bid[a] = price[g.to[i1]] + gap + eps;
+                }
+            };
+            const std::size_t n = bidders.size();
+            if (p == 1 || (int)n < PARALLEL_THRESHOLD) work(0, n);
+            else {
+                std::vector<std::thread> th;
+                const std::size_t chunk = (n + p - 1) / p;
+                for (int t = 1; t < p; ++t)
+                    th.emplace_back(work, std::min(n, t * chunk), std::min(n, (t + 1) * chunk));
+                work(0, std::min(n, chunk));
+                for (auto &t : th) t.join();
+            }
+
+            // the highest bid wins each object
+            touched.clear();
+            for (const int a : bidders) {
+                const int b = g.to[target[a]];
+                if (winner[b] < 0) touched.push_back(b);
+                if (winner[b] < 0 || best[b] < bid[a]) { best[b] = bid[a]; winner[b] = a; }
+            }
+            next.clear();
+            for (const int a : bidders)
+                if (winner[g.to[target[a]]] != a) next.push_back(a);
+            for (const int b : touched) {
+                if (0 <= owner[b]) { mate[owner[b]] = -1; next.push_back(owner[b]); }
+                const int a = winner[b];
+                owner[b] = a; mate[a] = target[a]; price[b] = best[b];
+                winner[b] = -1;
+            }
+            bidders.swap(next);
+        }
+    }
+};
+// -------------8<------- end of library ---------8-------------------------
+
+int main() {
+    std::cin.tie(0); std::ios::sync_with_stdio(false);
+
+    // n x n の重み行列に対する最大重み完全マッチング
+    int n;
+    std::cin >> n;
+
+    HungarianMatching<long long> g(n, n);
+    for (int a = 0; a < n; ++a)
+        for (int b = 0; b < n; ++b) {
+            long long w;
+            std::cin >> w;
+            g.add_edge(a, b, w);
+        }
+
+    std::cout << g.MaximumWeightPerfectMatching() << '\n';
+    for (int a = 0; a < n; ++a) std::cout << a << ' ' << g.Mate(a) << '\n';
+
+    return 0;
+}
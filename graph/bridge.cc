@@ -34,6 +34,10 @@
     後退辺ではない {u, v} に対して，{u, v} が橋 <==>  ord[u] < low[v] が成り立つ．
     lowlink が同じ値の頂点は同じ2辺連結成分に属する．
 
+  # Note
+    - Dfs は再帰なので深さの大きいグラフ（パスに近いグラフ）ではスタックが溢れる．
+      その場合は明示的なスタックを使う graph/lowlink.cc を使う
+
   # References
     - [保坂和宏，グラフ探索アルゴリズムとその応用](http://hos.ac/slides/20110504_graph.pdf)
 
@@ -0,0 +1,296 @@
+/*
+  Shortest Path Queries by Contraction Hierarchies
+  縮約階層法による2点間最短路クエリ
+  ================================================
+
+  # Problem
+    Input: 有向グラフ G = (V, E), 辺重み w : E -> R_{>=0}
+    Query: s, t \in V --> s から t への最短距離
+
+  # Complexity (n = |V|, m = |E|)
+    Time:
+      + 前処理: 理論的な保証はない（道路網では O(n log n) 程度）
+      + クエリ: 上向きの探索空間の大きさを n', m' として O((n' + m') log n')
+    Memory: O(n + m + ショートカットの数)
+
+  # Usage
+    - ContractionHierarchies<T> ch(n): 辺重みの型 T, 頂点数 n のグラフを構築
+    - ch.add_arc(u, v, w): 重み w の弧 (u, v) を追加
+    - ch.Preprocessing(): 頂点の縮約順序を決めてショートカットを追加する
+    - ch.Query(s, t): s から t への最短距離を返す. 経路が存在しない場合は INF を返す
+    - ch.Save(os) / ch.Load(is): 前処理の結果をバイナリ形式で書き出す / 読み込む
+      （Load した後は Preprocessing を行わずに Query を使うことができる）
+    - ch.rank[v]: v が縮約された順番
+
+  # Description
+    頂点を1つずつ縮約（contraction）して頂点の順位 rank を決める．頂点 v を縮約するときは，
+    縮約されていない頂点 u, x について弧 (u, v), (v, x) の組ごとに，v を通らない u から x への
+    道で w(u, v) + w(v, x) 以下のもの（witness）が存在するかを局所的なダイクストラ法で調べる．
+    存在しない場合は重み w(u, v) + w(v, x) の弧 (u, x)（ショートカット）を追加する．
+    縮約の順番は「追加されるショートカットの数 - 削除される弧の数（edge difference）」と
+    縮約済みの隣接頂点の数の和が小さい頂点から貪欲に選ぶ．この値はキューから取り出したときに
+    再計算して，次の頂点の値より大きくなっていればキューに戻す（lazy update）．
+    縮約した頂点の弧は残りのグラフから削除して，上向きの弧として保存する．
+
+    縮約後のグラフでは任意の s-t 最短路に対して，rank が単調に増加してから単調に減少する
+    同じ長さの道が存在する．したがって，クエリは s から rank の大きい頂点への弧だけをたどる
+    前向きの探索と，t から rank の大きい頂点への逆辺だけをたどる後ろ向きの探索を行い，
+    両方で到達した頂点 v について dist[v] + rdist[v] の最小値を求めればよい．
+    前処理の結果は上向きの弧だけを CSR 形式（head, to, w）で保持している．
+
+  # Note
+    - witness の探索は確定した頂点数が WITNESS_LIMIT を超えると打ち切る．打ち切ったときは
+      不要なショートカットが追加される可能性があるが，クエリの答えは正しい
+    - 経路復元が必要な場合はショートカットごとに縮約した頂点を保存して再帰的に展開する
+    - Save / Load の形式は T と int のバイト表現をそのまま書き出すので環境に依存する
+    - 比較は compare_speed_cpp/contraction_hierarchies.cc を参照
+
+  # References
+    - R. Geisberger, P. Sanders, D. Schultes, and D. Delling (2008): Contraction hierarchies:
+      Faster and simpler hierarchical routing in road networks. In Proceedings of WEA 2008,
+      LNCS 5038, pp. 319--333.
+*/
+
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <limits>
+#include <tuple>
+#include <algorithm>
+#include <functional>
+
+// -------------8<------- start of library -------8<------------------------
+template<class T>
+struct ContractionHierarchies {
+    struct Edge {
+        int dst; T w;
+        Edge() {};
+        Edge(int _d, T _w) : dst(_d), w(_w) {}
+    };
+    using State = std::pair<T, int>;
+    using Heap = std::priority_queue<State, std::vector<State>, std::greater<State>>;
+
+    static constexpr int WITNESS_LIMIT = 50;
+    const T INF = std::numeric_limits<T>::max();
+    int n;
+    std::vector<std::vector<Edge>> adj, radj;
+    std::vector<int> rank;
+
+    // upward graph (CSR): [0] forward search, [1] backward search
+    std::vector<int> head[2], to[2];
+    std::vector<T> w[2];
+
+    // query buffers (version stamps avoid O(n) initialization)
+    std::vector<T> dist[2];
+    std::vector<unsigned> stamp[2];
+    unsigned version = 0;
+
+    explicit ContractionHierarchies(int _n) : n(_n), adj(n), radj(n), rank(n, -1) {}
+
+    void add_arc(int u, int v, T _w) {
+        if (u == v) return;
+        adj[u].emplace_back(v, _w);
+        radj[v].emplace_back(u, _w);
+    }
+
+    void Preprocessing() {
+        std::vector<int> deleted(n, 0);
+        std::vector<char> contracted(n, false);
+        std::vector<T> wd(n, INF);
+        std::vector<int> touched;
+        std::vector<std::vector<Edge>> up[2];
+        up[0].resize(n); up[1].resize(n);
+
+        auto Contract = [&](const int v, const bool simulate) {
+            int shortcuts = 0;
+            T max_out = 0;
+            for (const auto &e : adj[v]) max_out = std::max(max_out, e.w);
+            for (const auto &in : radj[v]) {
+                const int u = in.dst;
+                WitnessSearch(u, v, in.w + max_out, wd, touched);
+                for (const auto &out : adj[v]) {
+                    const int x = out.dst;
+                    if (x == u || wd[x] <= in.w + out.w) continue;
+                    ++shortcuts;
+                    if (!simulate) AddShortcut(u, x, in.w + out.w);
+                }
+                for (int x : touched) wd[x] = INF;
+                touched.clear();
+            }
+            return shortcuts - (int)(adj[v].size() + radj[v].size()) + deleted[v];
+        };
+
+        auto Erase = [&](std::vector<Edge> &es, const int v) {
+            es.erase(std::remove_if(es.begin(), es.end(),
+                                    [&](const Edge &e) { return e.dst == v; }), es.end());
+        };
+
+        using Priority = std::pair<int, int>;
+        std::priority_queue<Priority, std::vector<Priority>, std::greater<Priority>> que;
+        for (int v = 0; v < n; ++v) que.emplace(Contract(v, true), v);
+
+        for (int r = 0; !que.empty(); ) {
+            const int v = que.top().second; que.pop();
+            if (contracted[v]) continue;
+            const int p = Contract(v, true);
+            if (!que.empty() && que.top().first < p) { que.emplace(p, v); continue; }
+
+            Contract(v, false);
+            contracted[v] = true;
+            rank[v] = r++;
+
+            // the remaining neighbors have higher ranks than v
+            for (const auto &e : adj[v]) { Erase(radj[e.dst], v); ++deleted[e.dst]; }
+            for (const auto &e : radj[v]) { Erase(adj[e.dst], v); ++deleted[e.dst]; }
+            up[0][v].swap(adj[v]); up[1][v].swap(radj[v]);
+        }
+
+        BuildUpwardGraph(up);
+    }
+
+    T Query(const int s, const int t) {
+        if (dist[0].size() != (std::size_t)n) {
+            for (int k = 0; k < 2; ++k) { dist[k].resize(n); stamp[k].assign(n, 0); }
+            version = 0;
+        }
+        if (++version == 0) {
+            for (int k = 0; k < 2; ++k) std::fill(stamp[k].begin(), stamp[k].end(), 0);
+            version = 1;
+        }
+        auto d = [&](int k, int v) { return stamp[k][v] == version ? dist[k][v] : INF; };
+
+        Heap que[2];
+        T mu = INF;
+        dist[0][s] = 0; stamp[0][s] = version; que[0].emplace(0, s);
+        dist[1][t] = 0; stamp[1][t] = version; que[1].emplace(0, t);
+
+        for (int k = 0; !que[0].empty() || !que[1].empty(); k ^= 1) {
+            if (que[k].empty()) continue;
+            T dv; int v;
+            std::tie(dv, v) = que[k].top();
+            if (mu <= dv) { Heap().swap(que[k]); continue; }
+            que[k].pop();
+            if (d(k, v) < dv) continue;
+            if (d(k ^ 1, v) != INF) mu = std::min(mu, dv + d(k ^ 1, v));
+
+            for (int i = head[k][v]; i < head[k][v + 1]; ++i) {
+                const int u = to[k][i];
+                if (dv + w[k][i] < d(k, u)) {
+                    dist[k][u] = dv + w[k][i]; stamp[k][u] = version;
+                    que[k].emplace(dist[k][u], u);
+                }
+            }
+        }
+        return mu;
+    }
+
+    void Save(std::ostream &os) const {
+        auto put = [&](const void *p, std::size_t sz) {
+            os.write(reinterpret_cast<const char*>(p), sz);
+        };
+        put(&n, sizeof(n));
+        put(rank.data(), sizeof(int) * n);
+        for (int k = 0; k < 2; ++k) {
+            const int m = to[k].size();
+            put(&m, sizeof(m));
+            put(head[k].data(), sizeof(int) * (n + 1));
+            put(to[k].data(), sizeof(int) * m);
+            put(w[k].data(), sizeof(T) * m);
+        }
+    }
+
+    bool Load(std::istream &is) {
+        auto get = [&](void *p, std::size_t sz) {
+            is.read(reinterpret_cast<char*>(p), sz);
+        };
+        get(&n, sizeof(n));
+        if (!is || n < 0) return false;
+        rank.resize(n);
+        get(rank.data(), sizeof(int) * n);
+        for (int k = 0; k < 2; ++k) {
+            int m;
+            get(&m, sizeof(m));
+            if (!is || m < 0) return false;
+            head[k].resize(n + 1); to[k].resize(m); w[k].resize(m);
+            get(head[k].data(), sizeof(int) * (n + 1));
+            get(to[k].data(), sizeof(int) * m);
+            get(w[k].data(), sizeof(T) * m);
+        }
+        dist[0].clear(); dist[1].clear();
+        return (bool)is;
+    }
+
+private:
+    // distances from u avoiding v in the remaining graph (stop at limit or WITNESS_LIMIT)
+    void WitnessSearch(const int u, const int v, const T limit,
+                       std::vector<T> &wd, std::vector<int> &touched) {
+        Heap que;
+        wd[u] = 0; touched.push_back(u);
+        que.emplace(0, u);
+        for (int settled = 0; !que.empty() && settled < WITNESS_LIMIT; ++settled) {
+            T d; int x;
+            std::tie(d, x) = que.top(); que.pop();
+            if (wd[x] < d) continue;
+            if (limit < d) break;
+            for (const auto &e : adj[x]) {
+                if (e.dst == v) continue;
+                if (d + e.w < wd[e.dst]) {
+                    if (wd[e.dst] == INF) touched.push_back(e.dst);
+                    wd[e.dst] = d + e.w;
+                    que.emplace(wd[e.dst], e.dst);
+                }
+            }
+        }
+    }
+
+    void AddShortcut(const int u, const int x, const T _w) {
+        for (auto &e : adj[u])
+            if (e.dst == x) {
+                if (_w < e.w) {
+                    e.w = _w;
+                    for (auto &r : radj[x]) if (r.dst == u) r.w = std::min(r.w, _w);
+                }
+                return;
+            }
+        adj[u].emplace_back(x, _w);
+        radj[x].emplace_back(u, _w);
+    }
+
+    void BuildUpwardGraph(const std::vector<std::vector<Edge>> up[2]) {
+        for (int k = 0; k < 2; ++k) {
+            head[k].assign(n + 1, 0);
+            to[k].clear(); w[k].clear();
+            for (int v = 0; v < n; ++v) {
+                for (const auto &e : up[k][v]) { to[k].push_back(e.dst); w[k].push_back(e.w); }
+                head[k][v + 1] = to[k].size();
+            }
+        }
+    }
+};
+// -------------8<------- end of library ---------8-------------------------
+
+int main() {
+    std::cin.tie(0); std::ios::sync_with_stdio(false);
+
+    int n, m;
+    std::cin >> n >> m;
+
+    ContractionHierarchies<long long> ch(n);
+    for (int i = 0, u, v; i < m; ++i) {
+        long long w;
+        std::cin >> u >> v >> w;
+        ch.add_arc(u, v, w);
+    }
+    ch.Preprocessing();
+
+    int q;
+    std::cin >> q;
+    for (int i = 0, s, t; i < q; ++i) {
+        std::cin >> s >> t;
+        const long long d = ch.Query(s, t);
+        if (d == ch.INF) std::cout << "INF\n";
+        else std::cout << d << '\n';
+    }
+
+    return 0;
+}
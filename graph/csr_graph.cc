@@ -0,0 +1,156 @@
+/*
+  Compressed Sparse Row (CSR) representation of a graph
+  隣接配列（CSR形式）によるグラフの表現
+  =====================================================
+
+  # Problem
+    Input: 有向グラフ G = (V, A)（無向グラフは両方向の弧で表す）, 弧重み w : A -> T
+    Query: 頂点 v から出る弧の列挙
+
+  # Complexity (n = |V|, m = |A|)
+    Time:
+      + 構築: O(n + m)
+      + 頂点 v から出る弧の列挙: O(deg(v))
+    Space: O(n + m)
+
+  # Usage
+    - CsrGraph<T> g(n): 弧重みの型 T, 頂点数 n の空のグラフを構築
+    - g.add_arc(u, v, w): 重み w の弧 (u, v) を追加（w を省略すると 1）. 辺番号を返す
+    - g.add_edge(u, v, w): 重み w の辺 {u, v} を追加（弧 (u, v) と (v, u) に同じ辺番号を付ける）
+    - g.build(): 追加した弧から隣接配列を構築（これ以降は弧を追加できない）
+    - g.degree(v): v から出る弧の数
+    - for (int i = g.head[v]; i < g.head[v + 1]; ++i): v から出る i 番目の弧
+      + g.to[i]: 弧の終点
+      + g.weight[i]: 弧の重み
+      + g.id[i]: 弧の辺番号（add_arc / add_edge を呼び出した順番）
+    - for (int u : g.adj(v)): v から出る弧の終点を列挙
+    - g.reverse(): すべての弧の向きを逆にしたグラフを返す（辺番号は保存される）
+
+    - g.n: 頂点数, g.m: 辺数（add_arc と add_edge の呼び出し回数）
+
+  # Description
+    std::vector<std::vector<Edge>> による隣接リストは頂点ごとに動的確保が行われるので，
+    頂点数や辺数が大きなグラフでは確保の回数とポインタを辿るコストが大きくなる．
+    CSR 形式では弧を始点の順に並べた1本の配列 to と，各頂点の弧の開始位置 head を使う．
+    頂点 v から出る弧は to[head[v]], ..., to[head[v + 1] - 1] に連続して格納されている．
+
+    構築は計数ソートで行う．弧のリストを1回走査して各頂点の出次数を数えて累積和を取り，
+    もう1回走査して各弧を配置する．同じ始点の弧は追加した順番に並ぶ（安定）．
+    終点・重み・辺番号は別の配列（Structure of Arrays）に格納しているので，
+    重みを使わない探索では to だけを連続に読むことになる．
+
+  # Note
+    - 無向グラフの橋や関節点などで多重辺を区別する必要があるときは辺番号 id を使う
+    - build() 後は弧のリストを解放するので，弧を追加し直すときは新しく構築する
+    - 弧の数が 2^31 を超える場合は head の型を long long に変更する
+
+  # References
+    - [Wikipedia: Sparse matrix - Compressed sparse row]
+      (https://en.wikipedia.org/wiki/Sparse_matrix)
+*/
+
+#include <iostream>
+#include <vector>
+#include <tuple>
+#include <cassert>
+
+// -------------8<------- start of library -------8<------------------------
+template<typename T = int>
+struct CsrGraph {
+    using weight_type = T;
+
+    struct Range {
+        const int *first, *last;
+        const int *begin() const { return first; }
+        const int *end() const { return last; }
+        int size() const { return last - first; }
+    };
+
+    int n, m = 0;
+    std::vector<int> head, to, id;
+    std::vector<T> weight;
+    std::vector<std::tuple<int, int, T, int>> arcs; // (src, dst, weight, id) before build
+
+    explicit CsrGraph(int _n = 0) : n(_n) {}
+
+    int add_arc(int u, int v, T w = 1) {
+        arcs.emplace_back(u, v, w, m);
+        return m++;
+    }
+
+    int add_edge(int u, int v, T w = 1) {
+        arcs.emplace_back(u, v, w, m);
+        arcs.emplace_back(v, u, w, m);
+        return m++;
+    }
+
+    void build() {
+        const int k = arcs.size();
+        head.assign(n + 1, 0);
+        for (const auto &a : arcs) ++head[std::get<0>(a) + 1];
+        for (int v = 0; v < n; ++v) head[v + 1] += head[v];
+
+        to.resize(k); id.resize(k); weight.resize(k);
+        std::vector<int> pos(head.begin(), head.end() - 1);
+        for (const auto &a : arcs) {
+            const int i = pos[std::get<0>(a)]++;
+            to[i] = std::get<1>(a);
+            weight[i] = std::get<2>(a);
+            id[i] = std::get<3>(a);
+        }
+        std::vector<std::tuple<int, int, T, int>>().swap(arcs);
+    }
+
+    int num_arcs() const { return to.size(); }
+    int degree(int v) const { return head[v + 1] - head[v]; }
+    Range adj(int v) const { return Range{to.data() + head[v], to.data() + head[v + 1]}; }
+
+    CsrGraph reverse() const {
+        assert((int)head.size() == n + 1);
+        CsrGraph r(n);
+        r.m = m;
+        r.head.assign(n + 1, 0);
+        for (int v : to) ++r.head[v + 1];
+        for (int v = 0; v < n; ++v) r.head[v + 1] += r.head[v];
+
+        r.to.resize(to.size()); r.id.resize(to.size()); r.weight.resize(to.size());
+        std::vector<int> pos(r.head.begin(), r.head.end() - 1);
+        for (int v = 0; v < n; ++v)
+            for (int i = head[v]; i < head[v + 1]; ++i) {
+                const int j = pos[to[i]]++;
+                r.to[j] = v;
+                r.weight[j] = weight[i];
+                r.id[j] = id[i];
+            }
+        return r;
+    }
+};
+// -------------8<------- end of library ---------8-------------------------
+
+int main() {
+    std::cin.tie(0); std::ios::sync_with_stdio(false);
+
+    int n, m;
+    std::cin >> n >> m;
+
+    CsrGraph<long long> g(n);
+    for (int i = 0, u, v; i < m; ++i) {
+        long long w;
+        std::cin >> u >> v >> w;
+        g.add_arc(u, v, w);
+    }
+    g.build();
+
+    // 各頂点から出る弧と入る弧を出力
+    auto r = g.reverse();
+    for (int v = 0; v < n; ++v) {
+        std::cout << v << " out:";
+        for (int i = g.head[v]; i < g.head[v + 1]; ++i)
+            std::cout << " (" << g.to[i] << ", " << g.weight[i] << ")";
+        std::cout << " in:";
+        for (int u : r.adj(v)) std::cout << ' ' << u;
+        std::cout << '\n';
+    }
+
+    return 0;
+}
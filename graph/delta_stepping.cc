@@ -0,0 +1,167 @@
+/*
+  Single Source Shortest Path Problem (parallel Delta-stepping)
+  単一始点全終点最短路問題（並列化した Delta-stepping 法）
+  ==============================================================
+
+  # Problem
+    Input: 有向グラフ G = (V, E), 辺重み w : E -> R_{>=0}, 始点 s
+    Output: s から各頂点 v への最短距離 d[v]
+
+  # Complexity (n = |V|, m = |E|, L = 最短距離の最大値, d = 最大次数, Δ = バケット幅)
+    Time: 最悪 O(n m)．弧重みが [0, 1] の一様乱数で Δ = Θ(1/d) のときの期待値は O(n + m + d L)
+    Memory: O(n + m)
+
+  # Usage
+    - CsrGraph<T> g(n): 弧重みの型 T, 頂点数 n のグラフ（graph/csr_graph.cc）
+    - g.add_arc(u, v, w), g.build(): 弧を追加して隣接配列を構築
+    - DeltaStepping<T> sp(g, delta, p): バケット幅 delta, p スレッドで g の最短路を求める
+      （delta を省略すると 最大の弧重み / 平均次数，p を省略するとコア数）
+    - sp.Run(s): s から各頂点への最短距離を求める
+    - sp.distance(t): s から t への最短距離を返す. 経路が存在しない場合は sp.INF を返す
+
+  # Description
+    暫定の距離 d[v] を幅 Δ のバケット B[i] = {v : iΔ <= d[v] < (i + 1)Δ} に分けて，
+    i の小さいバケットから順に処理する．Δ = 1（整数重み）とすると Dial のアルゴリズム，
+    Δ = ∞ とするとベルマン・フォード法に等しい．
+
+    重みが Δ 以下の弧を軽い弧（light），それ以外を重い弧（heavy）と呼ぶ．B[i] の頂点から
+    軽い弧を緩和すると B[i] に頂点が追加される可能性があるので，B[i] が空になるまで繰り返す．
+    その後，B[i] に一度でも入った頂点から重い弧を1回だけ緩和する（重い弧の終点は B[i + 1] 以降）．
+    同じバケットの頂点の緩和は互いに独立に行えるので，頂点をスレッドに分割して並列に緩和する．
+    d[v] の更新は compare-and-swap による atomic な最小値の更新で行い，更新に成功した頂点を
+    スレッドごとの配列に記録して，最後にまとめてバケットに追加する．
+
+  # Note
+    - 負の弧重みが存在する場合は使用できない（bellman_ford.cc の Spfa を使う）
+    - 頂点数が PARALLEL_THRESHOLD より小さいフェーズは逐次で処理する
+    - フェーズごとに std::thread を生成する
+    - バケットには同じ頂点が複数回入ることがあるが，d[v] が範囲外のものは取り出すときに読み飛ばす
+
+  # References
+    - U. Meyer and P. Sanders (2003): Δ-stepping: a parallelizable shortest path algorithm.
+      Journal of Algorithms, 49(1), pp. 114--152.
+*/
+
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+
+//  @require ./csr_graph.cc 👇👇
+
+// -------------8<------- start of library -------8<------------------------
+template<class T>
+struct DeltaStepping {
+    static constexpr int PARALLEL_THRESHOLD = 1024;
+    const T INF = std::numeric_limits<T>::max();
+    const CsrGraph<T> &g;
+    T delta;
+    const int p;
+    std::vector<std::atomic<T>> d;
+    std::vector<std::vector<int>> bucket, local;
+    std::vector<int> mark, fmark;
+
+    explicit DeltaStepping(const CsrGraph<T> &_g, T _delta = 0,
+                           int _p = std::max(1u, std::thread::hardware_concurrency()))
+        : g(_g), delta(_delta), p(_p), d(g.n), local(p), mark(g.n), fmark(g.n) {
+        if (delta <= 0) {
+            T max_w = 0;
+            for (const T w : g.weight) max_w = std::max(max_w, w);
+            const T avg_deg = std::max<T>(1, T(g.num_arcs()) / std::max(1, g.n));
+            delta = std::max<T>(max_w / avg_deg, std::numeric_limits<T>::is_integer ? 1 : 1e-9);
+        }
+    }
+
+    T distance(const int t) const { return d[t].load(); }
+
+    void Run(const int s) {
+        for (auto &x : d) x.store(INF, std::memory_order_relaxed);
+        std::fill(mark.begin(), mark.end(), -1);
+        std::fill(fmark.begin(), fmark.end(), -1);
+        bucket.assign(1, {s});
+        d[s] = 0;
+
+        std::vector<int> frontier, settled;
+        for (std::size_t i = 0, round = 0; i < bucket.size(); ++i) {
+            settled.clear();
+            while (!bucket[i].empty()) {
+                frontier.clear();
+                for (int v : bucket[i]) {
+                    if (Index(d[v].load()) != i || fmark[v] == (int)round) continue;
+                    fmark[v] = round; frontier.push_back(v);
+                    if (mark[v] != (int)i) { mark[v] = i; settled.push_back(v); }
+                }
+                ++round;
+                bucket[i].clear();
+                Relax(frontier, true);
+            }
+            Relax(settled, false);
+        }
+    }
+
+private:
+    std::size_t Index(const T x) const { return std::size_t(x / delta); }
+
+    void Relax(const std::vector<int> &vs, const bool light) {
+        auto work = [&](const int tid, std::size_t lo, std::size_t hi) {
+            for (std::size_t k = lo; k < hi; ++k) {
+                const int v = vs[k];
+                const T dv = d[v].load(std::memory_order_relaxed);
+                for (int i = g.head[v]; i < g.head[v + 1]; ++i) {
+                    if ((g.weight[i] <= delta) != light) continue;
+                    const int u = g.to[i];
+                    const T nd = dv + g.weight[i];
+                    T cur = d[u].load(std::memory_order_relaxed);
+                    while (nd < cur && !d[u].compare_exchange_weak(cur, nd)) {}
+                    if (nd < cur) local[tid].push_back(u);
+                }
+            }
+        };
+
+        if (p == 1 || (int)vs.size() < PARALLEL_THRESHOLD) work(0, 0, vs.size());
+        else {
+            std::vector<std::thread> th;
+            const std::size_t chunk = (vs.size() + p - 1) / p;
+            for (int t = 1; t < p; ++t)
+                th.emplace_back(work, t, std::min(vs.size(), t * chunk), std::min(vs.size(), (t + 1) * chunk));
+            work(0, 0, std::min(vs.size(), chunk));
+            for (auto &t : th) t.join();
+        }
+
+        for (auto &l : local) {
+            for (int u : l) {
+                const std::size_t b = Index(d[u].load(std::memory_order_relaxed));
+                if (bucket.size() <= b) bucket.resize(b + 1);
+                bucket[b].push_back(u);
+            }
+            l.clear();
+        }
+    }
+};
+// -------------8<------- end of library ---------8-------------------------
+
+int main() {
+    std::cin.tie(0); std::ios::sync_with_stdio(false);
+
+    // AOJ GRL_1_A: Shortest Path - Single Source Shortest Path
+    int n, m, r;
+    std::cin >> n >> m >> r;
+
+    CsrGraph<int> g(n);
+    for (int i = 0, s, t, w; i < m; ++i) {
+        std::cin >> s >> t >> w;
+        g.add_arc(s, t, w);
+    }
+    g.build();
+
+    DeltaStepping<int> sp(g);
+    sp.Run(r);
+    for (int v = 0; v < n; ++v) {
+        if (sp.distance(v) == sp.INF) std::cout << "INF\n";
+        else std::cout << sp.distance(v) << '\n';
+    }
+
+    return 0;
+}
@@ -4,7 +4,7 @@
   ========================================================
 
   # Problem
-    Input: 有向グラフ G = (V, E), 辺重み w : E -> R, 始点 s
+    Input: 有向グラフ G = (V, E), 辺重み w : E -> R_{>=0}, 始点 s
     Output: s から各頂点 v への最短距離 d[v]
 
   # Complexity (n = |V|, m = |E|)
@@ -15,13 +15,25 @@
     - Graph<T> g(n, s): 辺重みの型T，頂点数 n, 始点 s のグラフを構築．
                         2点間最短距離で終点 t が決まっている場合は g(n, s, t) とする
     - g.add_arc(u, v, w): 重み w の弧 (u, v) を追加
-    - g.Dijkstra(): ダイクストラ法で最短距離を求める（t が定まっている場合はif文をコメントアウト）
+    - g.Dijkstra(): ダイクストラ法で最短距離を求める（t が定まっている場合は t が確定した時点で終了）
     - g.distance(t): s から t への最短距離を返す. 経路が存在しない場合は INF を返す
+    - g.ChangeSource(s): 始点を変更して再度ダイクストラ法
+
+  # Description
+    各反復で未確定の頂点のうち d[v] が最小の頂点 v を線形探索で選んで確定し，v の行 adj[v][*]
+    で全頂点を緩和する．隣接行列は1次元配列 adj[v * n + u] に行優先で格納している．
+    - 確定済みかどうかは done[u] = (確定済みなら MAX, 未確定なら LOWEST) で表して，
+      キー max(d[u], done[u]) の最小値を求めることで確定済みの頂点を分岐なしで除外している．
+      最小値の探索は CHUNK 要素ごとの最小値（ベクトル化される）を求めてから，最小の CHUNK の中で
+      位置を探す．AVX2 が有効な場合 T = int については8要素ずつ最小値とその位置を同時に求める
+    - 弧がない位置は INF = max / 2 としているので，d[v] + adj[v][u] はオーバーフローせず
+      緩和は分岐のない d[u] = min(d[u], d[v] + adj[v][u]) になる（ベクトル化される）．
+      弧重みが非負なので確定済みの頂点の d[u] は変化しない
 
   # Note
-    - 負閉路が存在しない場合は有限回の反復で終了（それ以外の場合はベルマン・フォード法等を使用）
+    - 負の弧重みが存在する場合は使用できない（ベルマン・フォード法等を使用）
     - 疎なグラフは，ヒープを使用するダイクストラ法 O((n + m) * log n) dijkstra_heap.cc を使用する
-    - s-t最短路問題の場合はDijkstraのifをコメントアウトすると最適値が見つかったときに途中で打ち切る
+    - 比較は compare_speed_cpp/dijkstra_dense.cc を参照
 
   # References
     - あり本 pp. 96--97
@@ -34,36 +46,97 @@
 #include <iostream>
 #include <vector>
 #include <limits>
+#include <algorithm>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 
 // -------------8<------- start of library -------8<------------------------
 template<class T>
 struct Graph {
-    const T INF = std::numeric_limits<T>::max();
+    const T INF = std::numeric_limits<T>::max() / 2;
     const int n;
     int s, t;
-    std::vector<std::vector<T>> adj;
+    std::vector<T> adj;
     std::vector<T> d;
 
     Graph(int _n, int _s, int _t = -1)
-        : n(_n), s(_s), t(_t), adj(n, std::vector<T>(n, INF)), d(n, INF) { }
+        : n(_n), s(_s), t(_t), adj((std::size_t)n * n, INF), d(n, INF) { }
 
-    void add_arc(int u, int v, T w) { adj[u][v] = w; }
+    void add_arc(int u, int v, T w) {
+        T &x = adj[(std::size_t)u * n + v];
+        x = std::min(x, w);
+    }
     T distance(const int _t) const { return d[_t]; }
+    void ChangeSource(const int _s) { s = _s; Dijkstra(); }
 
     void Dijkstra() {
-        std::vector<bool> used(n, false);
+        std::vector<T> done(n, std::numeric_limits<T>::lowest());
+        std::fill(d.begin(), d.end(), INF);
         d[s] = 0;
-        while (true) {
-            int v = -1;
-            for (int u = 0; u < n; ++u)
-                if (!used[u] && (v == -1 || d[u] < d[v])) v = u;
-            if (v == -1 || INF <= d[v]) break;
-            // if (v == -1 || INF <= dist[v] || v == t) break;
-            used[v] = true;
-            for (int u = 0; u < n; ++u)
-                if (adj[v][u] != INF) d[u] = std::min(d[u], d[v] + adj[v][u]);
+        for (int iter = 0; iter < n; ++iter) {
+            const int v = ArgMin(d.data(), done.data(), n);
+            if (INF <= d[v]) break;
+            done[v] = std::numeric_limits<T>::max();
+            if (v == t) break;
+            const T dv = d[v];
+            const T *row = &adj[(std::size_t)v * n];
+            T *dist = d.data();
+#pragma GCC ivdep
+            for (int u = 0, _n = n; u < _n; ++u) {
+                const T x = dv + row[u];
+                dist[u] = x < dist[u] ? x : dist[u];
+            }
+        }
+    }
+
+private:
+    // argmin_u max(d[u], done[u]): minimum of each chunk (vectorized), then scan the best chunk
+    template<class U>
+    static int ArgMin(const U *d, const U *done, const int n) {
+        constexpr int CHUNK = 256;
+        U m = std::numeric_limits<U>::max();
+        int best = 0;
+        for (int b = 0; b < n; b += CHUNK) {
+            U cm = std::numeric_limits<U>::max();
+            for (int u = b, e = std::min(n, b + CHUNK); u < e; ++u) {
+                const U key = d[u] < done[u] ? done[u] : d[u];
+                cm = key < cm ? key : cm;
+            }
+            if (cm < m) { m = cm; best = b; }
+        }
+        for (int u = best; u < n; ++u)
+            if (std::max(d[u], done[u]) == m) return u;
+        return 0;
+    }
+
+#ifdef __AVX2__
+    static int ArgMin(const int *d, const int *done, const int n) {
+        __m256i vmin = _mm256_set1_epi32(std::numeric_limits<int>::max());
+        __m256i vidx = _mm256_setzero_si256(), idx = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        const __m256i eight = _mm256_set1_epi32(8);
+        int u = 0;
+        for (; u + 8 <= n; u += 8) {
+            const __m256i key = _mm256_max_epi32(_mm256_loadu_si256((const __m256i*)(d + u)),
+                                                 _mm256_loadu_si256((const __m256i*)(done + u)));
+            const __m256i lt = _mm256_cmpgt_epi32(vmin, key);
+            vmin = _mm256_blendv_epi8(vmin, key, lt);
+            vidx = _mm256_blendv_epi8(vidx, idx, lt);
+            idx = _mm256_add_epi32(idx, eight);
+        }
+        alignas(32) int mv[8], mi[8];
+        _mm256_store_si256((__m256i*)mv, vmin);
+        _mm256_store_si256((__m256i*)mi, vidx);
+        int m = std::numeric_limits<int>::max(), res = 0;
+        for (int k = 0; k < 8; ++k)
+            if (mv[k] < m || (mv[k] == m && mi[k] < res)) { m = mv[k]; res = mi[k]; }
+        for (; u < n; ++u) {
+            const int key = std::max(d[u], done[u]);
+            if (key < m) { m = key; res = u; }
         }
+        return res;
     }
+#endif
 };
 // -------------8<------- end of library ---------8-------------------------
 
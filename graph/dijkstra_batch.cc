@@ -0,0 +1,164 @@
+/*
+  Batched Shortest Path Queries (Dijkstra with heap on multiple threads)
+  最短路クエリの一括処理（複数スレッドでのヒープを使用したダイクストラ法）
+  =====================================================================
+
+  # Problem
+    Input: 有向グラフ G = (V, E), 辺重み w : E -> R_{>=0}
+    Query: 始点の列 s_1, ..., s_q（または始点と終点の組の列 (s_1, t_1), ..., (s_q, t_q)）
+           --> 各 s_i から各頂点への最短距離（または s_i から t_i への最短距離）
+
+  # Complexity (n = |V|, m = |E|, q = クエリ数, p = スレッド数)
+    Time:
+      + 単一始点: O(q (n + m) log n / p)
+      + 2点間: 各クエリで探索した頂点数と弧数を n', m' として O((n' + m') log n')
+    Memory: O(n + m + p n)（単一始点の場合は結果の O(q n) が必要）
+
+  # Usage
+    - CsrGraph<T> g(n): 弧重みの型 T, 頂点数 n のグラフ（graph/csr_graph.cc）
+    - g.add_arc(u, v, w), g.build(): 弧を追加して隣接配列を構築
+    - BatchDijkstra<T> sp(g, p): g に対する p スレッドのクエリ処理器を構築（p を省略するとコア数）
+    - sp.SingleSource(sources): 各 sources[i] から各頂点 v への最短距離 res[i][v] を返す
+    - sp.Distances(pairs): 各 pairs[i] = (s, t) に対して s から t への最短距離 res[i] を返す
+    - 到達不可能な場合は sp.INF
+
+  # Description
+    クエリごとに距離配列を確保して INF で初期化すると，2点間のクエリでも O(n) 時間かかる．
+    ここではスレッドごとに距離配列 dist とヒープ用の配列をクエリ間で再利用して，
+    各頂点にタイムスタンプ stamp[v] を持たせる．クエリごとに version を1つ増やして，
+    stamp[v] != version のときは dist[v] = INF とみなすことで初期化を不要にしている．
+    version が一周したときだけ stamp を 0 で初期化する．
+
+    クエリは共有のカウンタから各スレッドが1つずつ取り出すので，クエリごとに探索範囲が
+    異なっても負荷が偏りにくい．グラフ自体は読み取りのみなのでスレッド間で共有している．
+
+  # Note
+    - 各バッチの呼び出しごとに std::thread を生成する（クエリ数が少ないときは p = 1 とする）
+    - 2点間のクエリでは終点がヒープから取り出された時点で探索を打ち切る
+    - 負の弧重みが存在する場合は使用できない
+
+  # References
+    - あり本 pp. 96--97
+*/
+
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <atomic>
+
+//  @require ./csr_graph.cc 👇👇
+
+// -------------8<------- start of library -------8<------------------------
+template<class T>
+struct BatchDijkstra {
+    using State = std::pair<T, int>;
+
+    struct Workspace {
+        std::vector<T> dist;
+        std::vector<unsigned> stamp;
+        unsigned version = 0;
+        std::vector<State> heap;
+    };
+
+    const T INF = std::numeric_limits<T>::max();
+    const CsrGraph<T> &g;
+    std::vector<Workspace> ws;
+
+    explicit BatchDijkstra(const CsrGraph<T> &_g,
+                           int p = std::max(1u, std::thread::hardware_concurrency()))
+        : g(_g), ws(p) {}
+
+    std::vector<std::vector<T>> SingleSource(const std::vector<int> &sources) {
+        std::vector<std::vector<T>> res(sources.size());
+        ParallelFor(sources.size(), [&](Workspace &w, int i) {
+            Run(w, sources[i], -1);
+            res[i].resize(g.n);
+            for (int v = 0; v < g.n; ++v) res[i][v] = (w.stamp[v] == w.version ? w.dist[v] : INF);
+        });
+        return res;
+    }
+
+    std::vector<T> Distances(const std::vector<std::pair<int, int>> &pairs) {
+        std::vector<T> res(pairs.size());
+        ParallelFor(pairs.size(), [&](Workspace &w, int i) {
+            res[i] = Run(w, pairs[i].first, pairs[i].second);
+        });
+        return res;
+    }
+
+    template<class F>
+    void ParallelFor(const int q, F f) {
+        std::atomic<int> next(0);
+        auto worker = [&](Workspace &w) {
+            for (int i; (i = next++) < q; ) f(w, i);
+        };
+        const int p = std::min<int>(ws.size(), std::max(q, 1));
+        std::vector<std::thread> th;
+        for (int k = 1; k < p; ++k) th.emplace_back(worker, std::ref(ws[k]));
+        worker(ws[0]);
+        for (auto &t : th) t.join();
+    }
+
+    T Run(Workspace &w, const int s, const int t) {
+        if ((int)w.stamp.size() != g.n) {
+            w.dist.resize(g.n); w.stamp.assign(g.n, 0); w.version = 0;
+        }
+        if (++w.version == 0) { std::fill(w.stamp.begin(), w.stamp.end(), 0); w.version = 1; }
+
+        auto &heap = w.heap;
+        heap.clear();
+        heap.emplace_back(0, s);
+        w.dist[s] = 0; w.stamp[s] = w.version;
+
+        while (!heap.empty()) {
+            std::pop_heap(heap.begin(), heap.end(), std::greater<State>());
+            const T d = heap.back().first;
+            const int v = heap.back().second;
+            heap.pop_back();
+
+            if (w.dist[v] < d) continue;
+            if (v == t) return d;
+            for (int i = g.head[v]; i < g.head[v + 1]; ++i) {
+                const int u = g.to[i];
+                const T nd = d + g.weight[i];
+                if (w.stamp[u] != w.version || nd < w.dist[u]) {
+                    w.dist[u] = nd; w.stamp[u] = w.version;
+                    heap.emplace_back(nd, u);
+                    std::push_heap(heap.begin(), heap.end(), std::greater<State>());
+                }
+            }
+        }
+        return INF;
+    }
+};
+// -------------8<------- end of library ---------8-------------------------
+
+int main() {
+    std::cin.tie(0); std::ios::sync_with_stdio(false);
+
+    int n, m, q;
+    std::cin >> n >> m;
+
+    CsrGraph<long long> g(n);
+    for (int i = 0, u, v; i < m; ++i) {
+        long long w;
+        std::cin >> u >> v >> w;
+        g.add_arc(u, v, w);
+    }
+    g.build();
+
+    std::cin >> q;
+    std::vector<std::pair<int, int>> pairs(q);
+    for (auto &p : pairs) std::cin >> p.first >> p.second;
+
+    BatchDijkstra<long long> sp(g);
+    for (auto d : sp.Distances(pairs)) {
+        if (d == sp.INF) std::cout << "INF\n";
+        else std::cout << d << '\n';
+    }
+
+    return 0;
+}
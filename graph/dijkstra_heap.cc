@@ -7,8 +7,9 @@
     Input: 有向グラフ G = (V, E), 辺重み w : E -> R, 始点 s
     Output: s から各頂点 v への最短距離 d[v]
 
-  # Complexity (n = |V|, m = |E|)
+  # Complexity (n = |V|, m = |E|, C = 弧重みの最大値)
     Time: O((n + m) * log n)
+          RadixHeap: O(m log C), DialQueue: O(m + n C)
     Memory: O(n + m)
 
   # Usage
@@ -19,14 +20,40 @@
     - g.distance(t): s から t への最短距離を返す. 経路が存在しない場合は INF を返す
     - g.ChangeSource(s): 始点を変更して再度ダイクストラ法（TODO: 計算量を減らす方法があるかも）
 
+    - Graph<T, Queue> g(n, s): 優先度付きキューの実装 Queue を指定してグラフを構築
+      + BinaryHeap<T>: std::push_heap による二分ヒープ（デフォルト）
+      + RadixHeap<T>: 基数ヒープ（T が非負整数のときのみ）
+      + DialQueue<T>: 弧重みの最大値を C としたときの C + 1 個のバケットによるキュー（T が非負整数のときのみ）
+
   # Note
     - 負閉路が存在しない場合は有限回の反復で終了（それ以外の場合はベルマン・フォード法等を使用）
     - 密なグラフは，ヒープを使用しないダイクストラ法 O(n^2) dijkstra.cc を使用する
     - 経路復元が必要な場合は dijkstra_heap_sol.cc を使用
     - s-t最短路問題の場合はDijkstraのifをコメントアウトすると最適値が見つかったときに途中で打ち切る
+    - 弧重みが小さな非負整数のときは RadixHeap や DialQueue の方が高速
+      （比較は compare_speed_cpp/dijkstra_heap_queues.cc を参照）
+
+  # Description
+    ダイクストラ法で優先度付きキューから取り出されるキーの値は単調非減少なので（monotone），
+    整数の弧重みに対しては二分ヒープよりも高速なキューを使うことができる．
+
+    基数ヒープ（radix heap）は最後に取り出したキーを last としたとき，キー x を
+    x xor last の最上位ビットの位置 b (x = last のときは b = 0) のバケットに入れる．
+    取り出すときにバケット 0 が空ならば，空でない最小のバケットからキーが最小の要素を
+    新しい last として，そのバケットの要素を再配置する．再配置された要素は必ず番号の小さい
+    バケットへ移動する．キューの中のキーは [last, last + C] に含まれるので，
+    各要素の移動は高々 O(log C) 回となる．
+
+    Dial のアルゴリズムは弧重みの最大値を C としたとき，キューに入っているキーが常に
+    [last, last + C] に含まれることを用いて，C + 1 個のバケットを循環させて使う．
+    取り出しは空でないバケットまで last を進めるので全体で O(n C + m) 時間．
 
   # References
     - あり本 pp. 96--97
+    - R. K. Ahuja, K. Mehlhorn, J. B. Orlin, and R. E. Tarjan (1990):
+      Faster algorithms for the shortest path problem. Journal of the ACM, 37(2), pp. 213--223.
+    - R. B. Dial (1969): Algorithm 360: Shortest-path forest with topological ordering.
+      Communications of the ACM, 12(11), pp. 632--633.
 
   # Verified
     - [AOJ Graph2 - Single Source Shortest Path1]
@@ -35,12 +62,93 @@
 
 #include <iostream>
 #include <vector>
-#include <queue>
+#include <functional>
 #include <limits>
 #include <tuple>
+#include <type_traits>
+#include <algorithm>
+#include <cassert>
 
 // -------------8<------- start of library -------8<------------------------
 template<class T>
+struct BinaryHeap {
+    using State = std::pair<T, int>;
+    std::vector<State> d;
+
+    void reset(T) { d.clear(); }
+    bool empty() const { return d.empty(); }
+    void push(T key, int v) {
+        d.emplace_back(key, v);
+        std::push_heap(d.begin(), d.end(), std::greater<State>());
+    }
+    State pop() {
+        std::pop_heap(d.begin(), d.end(), std::greater<State>());
+        State res = d.back(); d.pop_back();
+        return res;
+    }
+};
+
+template<class T>
+struct RadixHeap {
+    static_assert(std::is_integral<T>::value, "RadixHeap requires an integral key");
+    using U = typename std::make_unsigned<T>::type;
+    using State = std::pair<T, int>;
+    static constexpr int B = std::numeric_limits<U>::digits;
+
+    std::vector<State> bucket[B + 1];
+    T last = 0;
+    std::size_t sz = 0;
+
+    static int bsr(U x) { return x == 0 ? 0 : 64 - __builtin_clzll(x); }
+
+    void reset(T) {
+        for (auto &b : bucket) b.clear();
+        last = 0; sz = 0;
+    }
+    bool empty() const { return sz == 0; }
+    void push(T key, int v) {
+        assert(last <= key);
+        bucket[bsr(U(key) ^ U(last))].emplace_back(key, v); ++sz;
+    }
+    State pop() {
+        if (bucket[0].empty()) {
+            int i = 1;
+            while (bucket[i].empty()) ++i;
+            last = bucket[i][0].first;
+            for (const auto &e : bucket[i]) last = std::min(last, e.first);
+            for (const auto &e : bucket[i]) bucket[bsr(U(e.first) ^ U(last))].push_back(e);
+            bucket[i].clear();
+        }
+        State res = bucket[0].back(); bucket[0].pop_back(); --sz;
+        return res;
+    }
+};
+
+template<class T>
+struct DialQueue {
+    static_assert(std::is_integral<T>::value, "DialQueue requires an integral key");
+    using State = std::pair<T, int>;
+
+    std::vector<std::vector<int>> bucket;
+    T last = 0;
+    std::size_t sz = 0;
+
+    void reset(T max_w) {
+        for (auto &b : bucket) b.clear();
+        bucket.resize(max_w + 1);
+        last = 0; sz = 0;
+    }
+    bool empty() const { return sz == 0; }
+    void push(T key, int v) { bucket[key % bucket.size()].push_back(v); ++sz; }
+    State pop() {
+        while (bucket[last % bucket.size()].empty()) ++last;
+        auto &b = bucket[last % bucket.size()];
+        State res(last, b.back()); b.pop_back(); --sz;
+        return res;
+    }
+};
+
+template<class T, class Queue = BinaryHeap<T>>
 struct Graph {
     struct Edge {
         int dst; T w;
@@ -51,35 +159,38 @@ struct Graph {
     const T INF = std::numeric_limits<T>::max();
     const int n;
     int s, t;
+    T max_w = 0;
     std::vector<std::vector<Edge>> adj;
     std::vector<T> dist;
+    Queue que;
 
     Graph(int _n, int _s, int _t = -1)
         : n(_n), s(_s), t(_t), adj(n), dist(n, INF) { }
 
-    void add_arc(int u, int v, T w) { adj[u].emplace_back(Edge(v, w)); }
+    void add_arc(int u, int v, T w) {
+        adj[u].emplace_back(Edge(v, w));
+        max_w = std::max(max_w, w);
+    }
     T distance(const int _t) const { return dist[_t]; }
     void ChangeSource(const int _s) {
         s = _s; std::fill(dist.begin(), dist.end(), INF); Dijkstra();
     }
 
     void Dijkstra() {
-        using State = std::pair<T, int>;
-        std::priority_queue<State, std::vector<State>, std::greater<State>> que;
-
-        que.emplace(0, s);
+        que.reset(max_w);
+        que.push(0, s);
         dist[s] = 0;
 
         while (!que.empty()) {
             T d; int v;
-            std::tie(d, v) = que.top(); que.pop();
+            std::tie(d, v) = que.pop();
 
             if (dist[v] < d) continue;
             // if (v == t) return ;
             for (const auto &e : adj[v]) {
                 if (d + e.w < dist[e.dst]) {
                     dist[e.dst] = d + e.w;
-                    que.emplace(dist[e.dst], e.dst);
+                    que.push(dist[e.dst], e.dst);
                 }
             }
         }
@@ -10,6 +10,8 @@
   # Complexity (n = |V|, m = |E|)
     Time:  Dijkstra  O((n + m) * log n)
           Find Path  O(n) (after dijkstra)
+          BidirectionalDijkstra / AStar  O((n' + m') * log n')
+            （n', m' は探索した頂点数と弧数．最悪の場合は Dijkstra と同じ）
     Memory: O(n + m)
 
   # Usage
@@ -20,14 +22,36 @@
     - g.distance(t): s から t への最短距離を返す. 経路が存在しない場合は INF を返す
     - g.ShortestPath(t): s から t への最短路を返す
 
+    - g.BidirectionalDijkstra(t): 双方向ダイクストラ法で s から t への最短距離を求める
+    - g.AStar(t, h): ポテンシャル h を使った A* 探索で s から t への最短距離を求める
+      （h(v) は v から t への最短距離の下界で h(u) <= w(u, v) + h(v) を満たすもの）
+    - 2点間の探索の後も g.distance(t) と g.ShortestPath(t) を使うことができる
+
   # Note
     - 負閉路が存在しない場合は有限回の反復で終了（それ以外の場合はベルマン・フォード法等を使用）
     - 密なグラフは，ヒープを使用しないダイクストラ法 O(n^2) dijkstra.cc を使用する
     - 経路復元が必要無い場合は dijkstra_heap.cc を使用
     - s-t最短路問題の場合はDijkstraのifをコメントアウトすると最適値が見つかったときに途中で打ち切る
+    - 2点間の探索では前回の探索で値を書き換えた頂点（touched）だけを初期化するので，
+      1回の探索は探索した範囲の大きさに比例した時間で終わる
+    - BidirectionalDijkstra と AStar の後の dist は t 以外の頂点では最短距離とは限らない
+
+  # Description
+    双方向ダイクストラ法は s からの探索（dist）と，逆辺をたどる t からの探索（rdist）を
+    キーの小さい方から交互に行う．弧を緩和したときに両方の探索で到達した頂点 v があれば
+    dist[v] + rdist[v] で暫定の最短距離 mu を更新する．2つのヒープの先頭のキーの和が
+    mu 以上になったとき，それより短い s-t 路は存在しないので探索を打ち切る．
+    最短路は mid から next をたどって t 側の prev を書き換えて復元する．
+
+    A* 探索は dist[v] + h(v) をキーとしたダイクストラ法である．h が上の条件（consistent）
+    を満たすとき，弧重みを w(u, v) - h(u) + h(v) >= 0 とした補正後のグラフ上の
+    ダイクストラ法と等しくなるので，t がヒープから取り出された時点で打ち切ってよい．
+    例えば平面上の道路網ではユークリッド距離を h とすることができる．
 
   # References
     - あり本 pp. 96--97
+    - A. V. Goldberg and C. Harrelson (2005): Computing the shortest path: A* search meets
+      graph theory. In Proceedings of SODA 2005, pp. 156--165.
 
   # Verified
 
@@ -48,17 +72,23 @@ struct Graph {
         Edge() {};
         Edge(int _d, T _w) : dst(_d), w(_w) {}
     };
+    using State = std::pair<T, int>;
+    using Heap = std::priority_queue<State, std::vector<State>, std::greater<State>>;
 
     const T INF = std::numeric_limits<T>::max();
     const int n, s, t;
-    std::vector<std::vector<Edge>> adj;
-    std::vector<T> dist;
-    std::vector<int> prev;
+    std::vector<std::vector<Edge>> adj, radj;
+    std::vector<T> dist, rdist;
+    std::vector<int> prev, next, touched;
 
     Graph(int _n, int _s, int _t = -1)
-        : n(_n), s(_s), t(_t), adj(n), dist(n, INF), prev(n, -1) { }
+        : n(_n), s(_s), t(_t), adj(n), radj(n), dist(n, INF), rdist(n, INF),
+          prev(n, -1), next(n, -1) { }
 
-    void add_arc(int u, int v, T w) { adj[u].emplace_back(Edge(v, w)); }
+    void add_arc(int u, int v, T w) {
+        adj[u].emplace_back(Edge(v, w));
+        radj[v].emplace_back(Edge(u, w));
+    }
     T distance(const int _t) const { return dist[_t]; }
 
     std::vector<int> ShortestPath(int _t) {
@@ -69,12 +99,17 @@ struct Graph {
         return path;
     }
 
+    void Reset() {
+        for (int v : touched) { dist[v] = rdist[v] = INF; prev[v] = next[v] = -1; }
+        touched.clear();
+    }
+
     void Dijkstra() {
-        using State = std::pair<T, int>;
-        std::priority_queue<State, std::vector<State>, std::greater<State>> que;
+        Reset();
+        Heap que;
 
         que.emplace(0, s);
-        dist[s] = 0;
+        dist[s] = 0; touched.push_back(s);
 
         while (!que.empty()) {
             T d; int v;
@@ -84,6 +119,7 @@ struct Graph {
             // if (v == t) return ;
             for (const auto &e : adj[v]) {
                 if (d + e.w < dist[e.dst]) {
+                    if (dist[e.dst] == INF) touched.push_back(e.dst);
                     dist[e.dst] = d + e.w;
                     prev[e.dst] = v;
                     que.emplace(dist[e.dst], e.dst);
@@ -91,6 +127,73 @@ struct Graph {
             }
         }
     }
+
+    T BidirectionalDijkstra(const int _t) {
+        Reset();
+        Heap que[2];
+        std::vector<T> *d[2] = {&dist, &rdist};
+        std::vector<int> *p[2] = {&prev, &next};
+        std::vector<std::vector<Edge>> *g[2] = {&adj, &radj};
+
+        T mu = INF;
+        int mid = -1;
+        dist[s] = 0; rdist[_t] = 0;
+        touched.push_back(s); touched.push_back(_t);
+        que[0].emplace(0, s); que[1].emplace(0, _t);
+        if (s == _t) { mu = 0; mid = s; }
+
+        while (!que[0].empty() && !que[1].empty()) {
+            if (mu != INF && mu <= que[0].top().first + que[1].top().first) break;
+            const int dir = (que[0].top().first <= que[1].top().first ? 0 : 1);
+            auto &dd = *d[dir], &od = *d[dir ^ 1];
+            T dv; int v;
+            std::tie(dv, v) = que[dir].top(); que[dir].pop();
+
+            if (dd[v] < dv) continue;
+            for (const auto &e : (*g[dir])[v]) {
+                if (dv + e.w < dd[e.dst]) {
+                    if (dist[e.dst] == INF && rdist[e.dst] == INF) touched.push_back(e.dst);
+                    dd[e.dst] = dv + e.w;
+                    (*p[dir])[e.dst] = v;
+                    que[dir].emplace(dd[e.dst], e.dst);
+                    if (od[e.dst] != INF && dd[e.dst] + od[e.dst] < mu) {
+                        mu = dd[e.dst] + od[e.dst];
+                        mid = e.dst;
+                    }
+                }
+            }
+        }
+
+        if (mid == -1) return dist[_t] = INF;
+        for (int v = mid; v != _t; v = next[v]) prev[next[v]] = v;
+        return dist[_t] = mu;
+    }
+
+    template<class Heuristic>
+    T AStar(const int _t, Heuristic h) {
+        Reset();
+        Heap que;
+
+        que.emplace(h(s), s);
+        dist[s] = 0; touched.push_back(s);
+
+        while (!que.empty()) {
+            T f; int v;
+            std::tie(f, v) = que.top(); que.pop();
+
+            if (dist[v] + h(v) < f) continue;
+            if (v == _t) break;
+            for (const auto &e : adj[v]) {
+                if (dist[v] + e.w < dist[e.dst]) {
+                    if (dist[e.dst] == INF) touched.push_back(e.dst);
+                    dist[e.dst] = dist[v] + e.w;
+                    prev[e.dst] = v;
+                    que.emplace(dist[e.dst] + h(e.dst), e.dst);
+                }
+            }
+        }
+        return dist[_t];
+    }
 };
 // -------------8<------- end of library ---------8-------------------------
 
@@ -7,16 +7,19 @@
     Input: 有向グラフ G = (V, E), 辺重み w : E -> R, 始点 s
     Output: 任意の2頂点 u, v 間の最短距離 d[u][v]
 
-  # Complexity (n = |V|, m = |E|)
-    Time: O(n^3)
-    Memory: O(n^2)
+  # Complexity (n = |V|, m = |E|, p = スレッド数)
+    Time: O(n^3 / p)
+    Memory: O(n^2)（経路復元を行う場合は次の頂点と辺数の行列の分だけ3倍）
 
   # Usage
-    - Graph<T> g(n, s): 辺重みの型T，頂点数 n
+    - Graph<T> g(n, path, p): 辺重みの型T，頂点数 n, 経路復元を行うか path（省略時 false），
+      スレッド数 p（省略するとコア数）
     - g.add_arc(u, v, w): 重み w の弧 (u, v) を追加
     - g.add_edge(u, v, w): 重み w の辺 {u, v} を追加
     - g.FloydWarshall(): フロイド・ワーシャル法で最短距離を求める
     - g.distance(u, v): u から v への最短距離を返す. g.INF と等しい場合は最短距離は存在しない
+    - g.ShortestPath(u, v): u から v への最短路の頂点列を返す（path = true のときのみ．
+      経路が存在しない場合は空）
     - g.CheckNegativeCycle(): g に負閉路が存在するか判定する (\exist v \in V, d[v][v] < 0)
 
   # Description
@@ -27,9 +30,37 @@
       （初め d[v][v] = 0 なので，ある k で d[v][k] + d[k][v] の結果が負となる．
         これは，v から k　への経路と k から v への経路を併せたもので負閉路である．
         逆に，負閉路が存在するときには漸化式の定義から d[v][v] < 0 となる）
+    - そのまま3重ループで実装すると k ごとに行列全体を読むので，n が大きいとキャッシュに
+      乗らない．そこで行列を BLOCK x BLOCK のブロックに分割して，k のブロック K ごとに
+        1. 対角ブロック (K, K) を通常の方法で更新する
+        2. ブロック K と同じ行と列のブロック (K, J), (I, K) を (K, K) を使って更新する
+        3. 残りのブロック (I, J) を (I, K) と (K, J) を使って更新する
+      の順に処理する（blocked Floyd-Warshall）．各ブロックの更新は k の順序を保っているので
+      結果は通常の方法と等しい．2 と 3 の各ブロックは互いに独立なので並列に処理できる．
+    - 行列は1次元配列に行優先で格納して，最内ループ c[j] = min(c[j], a + b[j]) は
+      分岐のない min-plus の演算にしているのでベクトル化される
+      （AVX2 が有効な場合は int, long long は組み込み関数で書いている）
+    - 経路復元は nxt[i][j] = 「i から j への最短路で i の次の頂点」を d と同時に更新する．
+      重み 0 の閉路があると同じ距離の経路が複数あり，ブロックの処理順によっては nxt を辿ると
+      閉路を回り続けることがある．そこで経路復元を行う場合は辺数 h[i][j] も持って
+      (距離, 辺数) の辞書式順序で比較する．nxt[i][j] = v ならば h[v][j] = h[i][j] - 1 なので
+      nxt を辿ると必ず j に到達する
+
+  # Note
+    - INF は std::numeric_limits<T>::max() / 2 として，INF + INF がオーバーフローしないように
+      している．最内ループでは d[k][j] = INF かどうかを判定しないので，最後に INF / 2 より
+      大きい値を INF に戻す（最短距離の絶対値は INF / 2 より小さいことを仮定している）
+    - 最内ループの c と b は同じ行を指すことがあるが，要素ごとに独立なので #pragma GCC ivdep で
+      依存関係の検査を省略している
+    - 頂点数は BLOCK の倍数に切り上げる（追加した頂点には弧がないので結果に影響しない）
+    - 負閉路が存在する場合は値が際限なく小さくなるのでオーバーフローする可能性がある
+    - 並列化はフェーズ（2 と 3）ごとに std::thread を生成する
+    - 比較は compare_speed_cpp/floyd_warshall.cc を参照
 
   # References
     - あり本 pp. 98--99
+    - G. Venkataraman, S. Sahni, and S. Mukhopadhyaya (2003): A blocked all-pairs shortest-paths
+      algorithm. Journal of Experimental Algorithmics, 8, pp. 2.2:1--2.2:23.
 
   # Verified
     - [AOJ Shortest Path - All Pairs Shortest Path]
@@ -39,35 +70,154 @@
 #include <iostream>
 #include <vector>
 #include <limits>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 
 // -------------8<------- start of library -------8<------------------------
 template<class T>
 struct Graph {
-    const T INF = std::numeric_limits<T>::max();
-    const int n;
+    static constexpr int BLOCK = 64;
+    const T INF = std::numeric_limits<T>::max() / 2;
+    const int n, N;  // N: n rounded up to a multiple of BLOCK (row stride)
+    const bool path;
+    const int p;
     bool is_neg_cycle;
-    std::vector<std::vector<T>> d;
-
-    explicit Graph(int _n) :
-        n(_n), is_neg_cycle(false), d(n, std::vector<T>(n, INF)) { }
-
-    void add_arc(int src, int dst, T w) { d[src][dst] = w; }
-    void add_edge(int src, int dst, T w) { d[src][dst] = d[dst][src] = w; }
-    T distance(const int src, const int dst) const { return d[src][dst]; }
+    std::vector<T> d;
+    std::vector<int> nxt, h;
+
+    explicit Graph(int _n, bool _path = false,
+                   int _p = std::max(1u, std::thread::hardware_concurrency())) :
+        n(_n), N((_n + BLOCK - 1) / BLOCK * BLOCK), path(_path), p(_p), is_neg_cycle(false),
+        d((std::size_t)N * N, INF), nxt(path ? (std::size_t)N * N : 0, -1),
+        h(path ? (std::size_t)N * N : 0, 0) { }
+
+    void add_arc(int src, int dst, T w) {
+        if (w < d[(std::size_t)src * N + dst]) {
+            d[(std::size_t)src * N + dst] = w;
+            if (path) { nxt[(std::size_t)src * N + dst] = dst; h[(std::size_t)src * N + dst] = 1; }
+        }
+    }
+    void add_edge(int src, int dst, T w) { add_arc(src, dst, w); add_arc(dst, src, w); }
+    T distance(const int src, const int dst) const { return d[(std::size_t)src * N + dst]; }
     bool CheckNegativeCycle() const { return is_neg_cycle; }
 
     void FloydWarshall() {
-        for (int v = 0; v < n; ++v) d[v][v] = 0;
-        for (int k = 0; k < n; ++k)
-            for (int i = 0; i < n; ++i) {
-                if (INF <= d[i][k]) continue;
-                for (int j = 0; j < n; ++j) {
-                    if (INF <= d[k][j]) continue;
-                    d[i][j] = std::min(d[i][j], d[i][k] + d[k][j]);
+        for (int v = 0; v < N; ++v) {
+            T &x = d[(std::size_t)v * N + v];
+            if (0 < x) { x = 0; if (path) { nxt[(std::size_t)v * N + v] = v; h[(std::size_t)v * N + v] = 0; } }
+        }
+
+        const int nb = N / BLOCK;
+        for (int K = 0; K < nb; ++K) {
+            Update(K, K, K);
+            Parallel(2 * (nb - 1), [&](int t) {
+                const int I = t / 2 < K ? t / 2 : t / 2 + 1;
+                if (t % 2 == 0) Update(K, I, K);
+                else Update(I, K, K);
+            });
+            Parallel((nb - 1) * (nb - 1), [&](int t) {
+                const int I = t / (nb - 1), J = t % (nb - 1);
+                Update(I < K ? I : I + 1, J < K ? J : J + 1, K);
+            });
+        }
+
+        for (auto &x : d) if (INF / 2 < x) x = INF;
+        for (int v = 0; v < n; ++v)
+            if (d[(std::size_t)v * N + v] < 0) is_neg_cycle = true;
+    }
+
+    std::vector<int> ShortestPath(int src, const int dst) const {
+        if (!path || INF <= distance(src, dst)) return {};
+        std::vector<int> res = {src};
+        while (src != dst) {
+            src = nxt[(std::size_t)src * N + dst];
+            res.push_back(src);
+        }
+        return res;
+    }
+
+private:
+    // block (I, J) <- min(block (I, J), block (I, K) (x) block (K, J)) in the (min, +) semiring
+    void Update(const int I, const int J, const int K) {
+        T *c = &d[((std::size_t)I * N + J) * BLOCK];
+        const T *a = &d[((std::size_t)I * N + K) * BLOCK];
+        const T *b = &d[((std::size_t)K * N + J) * BLOCK];
+        for (int k = 0; k < BLOCK; ++k)
+            for (int i = 0; i < BLOCK; ++i) {
+                const T aik = a[(std::size_t)i * N + k];
+                if (INF <= aik) continue;
+                if (!path) MinPlus(c + (std::size_t)i * N, b + (std::size_t)k * N, aik);
+                else {
+                    const std::size_t r = ((std::size_t)I * BLOCK + i) * N;
+                    const std::size_t rk = ((std::size_t)K * BLOCK + k) * N;
+                    MinPlus(c + (std::size_t)i * N, &h[r + J * BLOCK], &nxt[r + J * BLOCK],
+                            b + (std::size_t)k * N, &h[rk + J * BLOCK],
+                            aik, h[r + K * BLOCK + k], nxt[r + K * BLOCK + k]);
                 }
             }
-        for (int v = 0; v < n; ++v)
-            if (d[v][v] < 0) is_neg_cycle = true;
+    }
+
+    template<class U>
+    static void MinPlus(U *c, const U *b, const U a) {
+#pragma GCC ivdep
+        for (int j = 0; j < BLOCK; ++j) {
+            const U x = a + b[j];
+            c[j] = x < c[j] ? x : c[j];
+        }
+    }
+
+    // (distance, number of arcs) in the lexicographic order; x > INF / 2 means unreachable
+    template<class U>
+    static void MinPlus(U *c, int *hc, int *pc, const U *b, const int *hb,
+                        const U a, const int ha, const int pa) {
+        constexpr U LIMIT = std::numeric_limits<U>::max() / 4;
+#pragma GCC ivdep
+        for (int j = 0; j < BLOCK; ++j) {
+            const U x = a + b[j], z = c[j];
+            const int y = ha + hb[j], hz = hc[j];
+            const bool lt = x <= LIMIT && (x < z || (x == z && y < hz));
+            const int m = -(int)lt;  // the mask form lets the int arrays be vectorized
+            c[j] = lt ? x : z;
+            hc[j] = (y & m) | (hz & ~m);
+            pc[j] = (pa & m) | (pc[j] & ~m);
+        }
+    }
+
+#ifdef __AVX2__
+    static void MinPlus(int *c, const int *b, const int a) {
+        const __m256i va = _mm256_set1_epi32(a);
+        for (int j = 0; j < BLOCK; j += 8) {
+            const __m256i x = _mm256_add_epi32(va, _mm256_loadu_si256((const __m256i*)(b + j)));
+            const __m256i y = _mm256_loadu_si256((const __m256i*)(c + j));
+            _mm256_storeu_si256((__m256i*)(c + j), _mm256_min_epi32(x, y));
+        }
+    }
+
+    static void MinPlus(long long *c, const long long *b, const long long a) {
+        const __m256i va = _mm256_set1_epi64x(a);
+        for (int j = 0; j < BLOCK; j += 4) {
+            const __m256i x = _mm256_add_epi64(va, _mm256_loadu_si256((const __m256i*)(b + j)));
+            const __m256i y = _mm256_loadu_si256((const __m256i*)(c + j));
+            const __m256i gt = _mm256_cmpgt_epi64(y, x);
+            _mm256_storeu_si256((__m256i*)(c + j), _mm256_blendv_epi8(y, x, gt));
+        }
+    }
+#endif
+
+    template<class F>
+    void Parallel(const int tasks, F f) {
+        const int q = std::min(p, tasks);
+        if (q <= 1) { for (int t = 0; t < tasks; ++t) f(t); return; }
+        std::atomic<int> next(0);
+        auto worker = [&]() { for (int t; (t = next++) < tasks; ) f(t); };
+        std::vector<std::thread> th;
+        for (int k = 1; k < q; ++k) th.emplace_back(worker);
+        worker();
+        for (auto &t : th) t.join();
     }
 };
 // -------------8<------- end of library ---------8-------------------------
@@ -82,7 +232,7 @@ int main() {
     Graph<int> g(n);
     for (int i = 0; i < m; ++i) {
         std::cin >> s >> t >> d;
-        g.add_edge(s, t, d);
+        g.add_arc(s, t, d);
     }
 
     g.FloydWarshall();
@@ -0,0 +1,203 @@
+/*
+  Maximum Matching in General Graphs (Edmonds' blossom algorithm)
+  一般グラフの最大マッチング（エドモンズの花アルゴリズム）
+  ===============================================================
+
+  # Problem
+    Input: 無向グラフ G = (V, E)
+    Output: G の最大マッチングのサイズ
+
+    Def. マッチング(Matching) -> graph/bipartite_maximum_matching.cc
+
+  # Complexity (n = |V|, m = |E|)
+    Time : O(n m α(n))
+    Space : O(n + m)
+
+  # Usage
+    - GeneralMatching g(n): 頂点数 n の辺のないグラフを構築
+    - g.add_edge(u, v): 辺 {u, v} を追加
+    - g.MaximumMatching(): 最大マッチングのサイズを返す
+    - g.Mate(v): v とマッチした頂点（マッチしていなければ -1）
+
+  # Description
+    マッチしていない頂点 r を根として，交互道の木を幅優先探索で作る．根からの距離が偶数の頂点を
+    偶頂点，奇数の頂点を奇頂点と呼ぶ．偶頂点 v から
+      + マッチしていない頂点に到達したら増加道が見つかったので増加させる
+      + 木にない頂点 u に到達したら u（奇頂点）と mate(u)（偶頂点）を木に追加する
+      + 別の偶頂点 u に到達したら奇閉路（花，blossom）ができるので，花を1つの頂点に縮約する
+    二部グラフと違って奇閉路があるので縮約が必要になる．縮約した花の頂点はすべて偶頂点になり，
+    花の根（base）を代表元とする union-find で管理する．花の中の道は，奇頂点だった頂点に
+    親 link を付け替えることで復元できるようにしておく．
+
+    根 r からの探索が失敗したとき，探索した頂点（Hungarian tree）を通る増加道はその後も
+    存在しないので，それらの頂点は以後の探索から除外する．最初のマッチングは貪欲法で作る．
+    グラフは CSR 形式（graph/csr_graph.cc）で持ち，探索ごとの初期化は訪れた頂点だけ行う．
+
+  # Note
+    - 二部グラフならば graph/bipartite_maximum_matching.cc（Hopcroft-Karp）の方が速い
+    - O(sqrt(n) m) の Micali-Vazirani のアルゴリズムは実装が複雑なので使っていない
+    - MaximumMatching を呼んだ後は辺を追加できない
+
+  # References
+    - J. Edmonds (1965): Paths, trees, and flowers. Canadian Journal of Mathematics, 17,
+      pp. 449--467.
+    - H. N. Gabow (1976): An efficient implementation of Edmonds' algorithm for maximum
+      matching on graphs. Journal of the ACM, 23(2), pp. 221--234.
+    - [e-maxx: Edmonds' algorithm for finding the maximum matching in general graphs]
+      (https://cp-algorithms.com/graph/Edmonds_matching.html)
+
+  # Verified
+    - [Library Checker: Matching on General Graph]
+      (https://judge.yosupo.jp/problem/general_matching)
+*/
+
+#include <iostream>
+#include <vector>
+#include <tuple>
+#include <cassert>
+
+//  @require ./csr_graph.cc 👇👇
+
+// -------------8<------- start of library -------8<------------------------
+class GeneralMatching {
+public:
+    explicit GeneralMatching(int _n)
+        : n(_n), g(n), mate(n, -1), size_match(0) {}
+
+    void add_edge(const int u, const int v) {
+        if (u != v) g.add_edge(u, v);
+    }
+
+    int Mate(const int v) const { return mate[v]; }
+
+    int MaximumMatching() {
+        if ((int)g.head.size() != n + 1) {
+            g.build();
+            link.assign(n, -1); uf.assign(n, -1); base.resize(n);
+            even.assign(n, false); dead.assign(n, false); mark.assign(n, 0);
+            for (int v = 0; v < n; ++v) base[v] = v;
+            // greedy initial matching
+            for (int v = 0; v < n; ++v)
+                for (const int u : g.adj(v))
+                    if (mate[v] < 0 && mate[u] < 0) { mate[v] = u; mate[u] = v; ++size_match; }
+        }
+        for (int r = 0; r < n; ++r)
+            if (mate[r] < 0 && !dead[r] && Augment(r)) ++size_match;
+        return size_match;
+    }
+
+private:
+    const int n;
+    CsrGraph<int> g;
+    std::vector<int> mate, link, uf, base, que, visited, path;
+    std::vector<char> even, dead;
+    std::vector<unsigned> mark;
+    unsigned stamp = 0;
+    int size_match;
+
+    int find(int v) {
+        while (0 <= uf[v] && 0 <= uf[uf[v]]) v = uf[v] = uf[uf[v]];
+        return uf[v] < 0 ? v : uf[v];
+    }
+    int Base(const int v) { return base[find(v)]; }
+    void Unite(int u, int v) {
+        const int b = Base(v);
+        u = find(u); v = find(v);
+        if (u == v) return;
+        if (uf[v] < uf[u]) std::swap(u, v);  // u has more vertices
+        uf[u] += uf[v]; uf[v] = u;
+        base[u] = b;
+    }
+
+    void Visit(const int v) { visited.push_back(v); }
+
+    // the base of the smallest blossom containing the bases x and y in the tree
+    int Lca(int x, int y) {
+        ++stamp;
+        while (true) {
+            if (0 <= x) {
+                if (mark[x] == stamp) return x;
+                mark[x] = stamp;
+                x = (mate[x] < 0 ? -1 : Base(link[mate[x]]));
+            }
+            std::swap(x, y);
+        }
+    }
+
+    // sets the links along the path from v to the base b, collecting the vertices on it
+    void MarkPath(int v, const int b, int child) {
+        while (Base(v) != b) {
+            const int m = mate[v];
+            link[v] = child;
+            child = m;
+            path.push_back(v); path.push_back(m);
+            v = link[m];
+        }
+    }
+
+    bool Augment(const int r) {
+        visited.clear(); que.clear();
+        Visit(r); even[r] = true; que.push_back(r);
+        bool found = false;
+        for (std::size_t k = 0; k < que.size() && !found; ++k) {
+            const int v = que[k];
+            for (const int u : g.adj(v)) {
+                if (dead[u] || mate[v] == u || Base(v) == Base(u)) continue;
+                if (even[u]) {
+                    // contracts the blossom
+                    const int b = Lca(Base(v), Base(u));
+                    path.clear();
+                    MarkPath(v, b, u);
+                    MarkPath(u, b, v);
+                    for (const int x : path) {
+                        if (!even[x]) { even[x] = true; que.push_back(x); }
+                        Unite(x, b);
+                    }
+                }
+                else if (link[u] < 0) {
+                    Visit(u); link[u] = v;
+                    if (mate[u] < 0) {
+                        // flips the augmenting path ending at u
+                        for (int x = u; 0 <= x; ) {
+                            const int y = link[x], z = mate[y];
+                            mate[x] = y; mate[y] = x;
+                            x = z;
+                        }
+                        found = true;
+                        break;
+                    }
+                    const int w = mate[u];
+                    Visit(w); even[w] = true; que.push_back(w);
+                }
+            }
+        }
+
+        // the Hungarian tree of a failed search never contains an augmenting path
+        for (const int v : visited) {
+            if (!found) dead[v] = true;
+            link[v] = -1; uf[v] = -1; base[v] = v; even[v] = false;
+        }
+        return found;
+    }
+};
+// -------------8<------- end of library ---------8-------------------------
+
+int main() {
+    std::cin.tie(0); std::ios::sync_with_stdio(false);
+
+    // Library Checker: Matching on General Graph
+    int n, m;
+    std::cin >> n >> m;
+
+    GeneralMatching g(n);
+    for (int i = 0, u, v; i < m; ++i) {
+        std::cin >> u >> v;
+        g.add_edge(u, v);
+    }
+
+    std::cout << g.MaximumMatching() << '\n';
+    for (int v = 0; v < n; ++v)
+        if (v < g.Mate(v)) std::cout << v << ' ' << g.Mate(v) << '\n';
+
+    return 0;
+}
@@ -0,0 +1,190 @@
+/*
+  Heavy-Light Decomposition
+  重軽分解（HL 分解）
+  ========================
+
+  # Problem
+    Input: 根付き木 (T = (V, E), r), 各頂点（または各辺）の値
+    Query:
+      ・パス u-v 上の頂点（辺）の値の畳み込み（和，最小値，最大値など）
+      ・頂点の値の変更，パス u-v 上の頂点（辺）の値への一様な加算
+      ・頂点 v の部分木の値の畳み込み
+
+  # Complexity (n = |V|)
+    Time:
+      + 前処理: O(n)
+      + パスを区間に分解: O(log n) 個の区間
+      + パスのクエリ: O(log^2 n)（区間ごとに区間木やフェニック木で O(log n)）
+    Space: O(n)
+
+  # Usage
+    - HeavyLightDecomposition hld(n, r): 頂点数 n, 根のラベル r の根付き木を構成
+    - hld.add_edge(u, v): 辺 {u, v} を追加
+    - hld.build(): 分解を求める（これ以降は辺を追加できない．再度呼んでもよい）
+    - hld.in[v]: 列での頂点 v の位置（辺 (par(v), v) の値も in[v] に置く）
+    - hld.par[v], hld.dep[v], hld.head[v]: v の親（根は -1）, 深さ, v を含む heavy path の先頭
+    - hld.lca(u, v): u と v の最小共通祖先
+    - hld.ForEachPath(u, v, f, edge): パス u-v を列の区間に分解して，各区間 [l, r) で f(l, r) を呼ぶ
+      （edge = true ならば頂点の代わりに辺 (par(w), w) の区間になり，lca(u, v) は含まない）
+    - hld.Subtree(v): v の部分木に対応する列の区間 [l, r)
+
+    - hld.PathAccumulate(seg, u, v, edge): 区間木 seg（data_structure/segment_tree_update_element_
+      accumulate_interval.cc）でパス u-v の値を畳み込む（可換モノイドのみ）．
+      頂点 v の値の変更は seg.update(hld.in[v], x)
+
+    - 区間加算・区間和は RangeSumQuery<T> rsq(n)（data_structure/fenwick_tree_range_sum_query.cc）
+      を使う．パスへの加算は hld.ForEachPath(u, v, [&](int l, int r) { rsq.add(l, r, x); })
+
+  # Description
+    各頂点 v について，部分木のサイズが最大の子を heavy な子，他の子を light な子と呼び，
+    heavy な子への辺だけをたどってできるパスを heavy path と呼ぶ．木は頂点素な heavy path に
+    分割される．light な子 c の部分木のサイズは v の部分木のサイズの半分以下なので，根から
+    どの頂点へのパスも O(log n) 本の heavy path にしか交わらない．
+
+    深さ優先探索で常に heavy な子を最初に訪問して行きがけ順に番号 in[v] を付けると，
+    各 heavy path は列の連続した区間になり，部分木も区間 [in[v], in[v] + size(v)) になる．
+    パス u-v は，先頭がより深い heavy path から順に [in[head], in[w] + 1) を取り出して
+    w = par(head) に移ることを u と v の先頭が一致するまで繰り返すと O(log n) 個の区間に分かれる．
+    各区間に区間木（最小値・最大値・和）やフェニック木（区間加算・区間和）を使えば，
+    パスのクエリは O(log^2 n) 時間になる．
+
+    辺の値は子の側の頂点 w の位置 in[w] に置く．このとき最後の区間から lca の位置を除けばよい．
+    部分木のサイズは1回目の探索の行きがけ順を逆にたどって求めるので，2回の探索はどちらも
+    スタックから取り出すだけの反復で書ける（パスグラフのような深い木でも再帰しない）．
+
+  # Note
+    - ForEachPath が区間を呼ぶ順番はパスの順番ではないので，非可換なモノイドには使えない
+    - 頂点の値が変わらないパスの和は，根からの累積和と graph/lca_farach_colton_bender.cc の方が速い
+
+  # References
+    - D. D. Sleator and R. E. Tarjan (1983): A data structure for dynamic trees.
+      Journal of Computer and System Sciences, 26(3), pp. 362--391.
+    - [@beet HL分解](https://beet-aizu.hatenablog.com/entry/2017/12/12/235950)
+    - [cp-algorithms: Heavy-light decomposition]
+      (https://cp-algorithms.com/graph/hld.html)
+
+  # Verified
+    - [AOJ GRL_5_E Tree - Range Query on a Tree II]
+      (http://judge.u-aizu.ac.jp/onlinejudge/description.jsp?id=GRL_5_E)
+*/
+
+#include <iostream>
+#include <vector>
+#include <tuple>
+#include <limits>
+#include <cassert>
+
+//  @require ./csr_graph.cc 👇👇
+//  @require ../data_structure/segment_tree_update_element_accumulate_interval.cc 👇👇
+//  @require ../data_structure/fenwick_tree_range_sum_query.cc 👇👇
+
+// -------------8<------- start of library -------8<------------------------
+struct HeavyLightDecomposition {
+    const int root, n;
+    CsrGraph<int> g;
+    std::vector<int> par, dep, head, in, sz;
+
+    explicit HeavyLightDecomposition(int _n, int _r = 0) : root(_r), n(_n), g(n) {}
+
+    void add_edge(int u, int v) { g.add_edge(u, v); }
+
+    void build() {
+        if ((int)g.head.size() != n + 1) g.build();
+        par.assign(n, -1); dep.assign(n, 0); head.assign(n, root); in.assign(n, 0); sz.assign(n, 1);
+
+        // preorder by an iterative DFS, then the sizes of the subtrees from the leaves
+        std::vector<int> order, heavy(n, -1), stk(1, root);
+        order.reserve(n);
+        while (!stk.empty()) {
+            const int v = stk.back(); stk.pop_back();
+            order.push_back(v);
+            for (const int u : g.adj(v))
+                if (u != par[v]) { par[u] = v; dep[u] = dep[v] + 1; stk.push_back(u); }
+        }
+        assert((int)order.size() == n);
+        for (int i = n - 1; 0 < i; --i) {
+            const int v = order[i], p = par[v];
+            sz[p] += sz[v];
+            if (heavy[p] < 0 || sz[heavy[p]] < sz[v]) heavy[p] = v;
+        }
+
+        // the heavy child is visited next, so each heavy path is contiguous
+        int t = 0;
+        stk.assign(1, root);
+        while (!stk.empty()) {
+            const int v = stk.back(); stk.pop_back();
+            in[v] = t++;
+            for (const int u : g.adj(v))
+                if (u != par[v] && u != heavy[v]) { head[u] = u; stk.push_back(u); }
+            if (0 <= heavy[v]) { head[heavy[v]] = head[v]; stk.push_back(heavy[v]); }
+        }
+    }
+
+    int lca(int u, int v) const {
+        for ( ; head[u] != head[v]; u = par[head[u]])
+            if (in[head[u]] < in[head[v]]) std::swap(u, v);
+        return dep[u] < dep[v] ? u : v;
+    }
+
+    template<class F>
+    void ForEachPath(int u, int v, F f, const bool edge = false) const {
+        for ( ; head[u] != head[v]; u = par[head[u]]) {
+            if (in[head[u]] < in[head[v]]) std::swap(u, v);
+            f(in[head[u]], in[u] + 1);
+        }
+        if (in[v] < in[u]) std::swap(u, v);
+        if (in[u] + edge <= in[v]) f(in[u] + edge, in[v] + 1);
+    }
+
+    std::pair<int, int> Subtree(const int v) const { return {in[v], in[v] + sz[v]}; }
+
+    template<class Monoid>
+    typename Monoid::value_type PathAccumulate(const SegmentTree<Monoid> &seg, const int u, const int v,
+                                               const bool edge = false) const {
+        auto res = Monoid::unit();
+        ForEachPath(u, v, [&](int l, int r) { res = Monoid::op(res, seg.accumulate(l, r)); }, edge);
+        return res;
+    }
+};
+
+// -------------8<------- end of library ---------8-------------------------
+
+int main() {
+    std::cin.tie(0); std::ios::sync_with_stdio(false);
+
+    // AOJ GRL_5_E: Tree - Range Query on a Tree II
+    int n;
+    std::cin >> n;
+
+    HeavyLightDecomposition hld(n, 0);
+    for (int v = 0, deg, c; v < n; ++v) {
+        std::cin >> deg;
+        while (deg--) {
+            std::cin >> c;
+            hld.add_edge(v, c);
+        }
+    }
+    hld.build();
+
+    // the weight of the edge (par(v), v) is at in[v]
+    RangeSumQuery<long long> rsq(n);
+    int q;
+    std::cin >> q;
+    for (int i = 0, com; i < q; ++i) {
+        std::cin >> com;
+        if (com == 0) {
+            int v, w;
+            std::cin >> v >> w;
+            hld.ForEachPath(0, v, [&](int l, int r) { rsq.add(l, r, w); }, true);
+        }
+        else {
+            int u;
+            std::cin >> u;
+            long long res = 0;
+            hld.ForEachPath(0, u, [&](int l, int r) { res += rsq.sum(l, r); }, true);
+            std::cout << res << '\n';
+        }
+    }
+
+    return 0;
+}
@@ -16,9 +16,9 @@
     - Memory: O(n + m)
 
   # Usage
-    - Graph g(n): 頂点数 n の無向グラフを構築
-    - g.add_edge(u, v): 辺 {u, v} を追加
-    - IsBipartite(g): g が二部グラフかどうかを判定する
+    - CsrGraph<> g(n): 頂点数 n の無向グラフを構築（graph/csr_graph.cc）
+    - g.add_edge(u, v), g.build(): 辺 {u, v} を追加して隣接配列を構築
+    - IsBipartite(g, p): g が二部グラフかどうかを p スレッドで判定する（p を省略するとコア数）
 
   # Description
     二部グラフの有名な特徴付けとして次が知られている．
@@ -26,7 +26,10 @@
       2. G が二部グラフ <=> G は長さ奇数の閉路を部分グラフとして持たない
 
     ここでは，1番目の特徴付けに基づいてアルゴリズムを構成している．
-    すなわち，任意の頂点から深さ優先探索で貪欲彩色を行う．
+    すなわち，各連結成分で幅優先探索を行い，始点からの距離の偶奇で2彩色する．
+    BFS 木の辺は両端の距離が1だけ異なるので，距離の偶奇が等しい辺が存在しなければ
+    2彩色になっていて，存在すればその辺と BFS 木の道で長さ奇数の閉路ができる．
+    幅優先探索は方向最適化 BFS（graph/bfs_direction_optimizing.cc）を使う．
 
   # Verified
     @tmaehara さんの実装とランダムグラフ上で比較
@@ -35,32 +38,19 @@
 
 #include <iostream>
 #include <vector>
-#include <functional>
+#include <thread>
 
-// -------------8<------- start of library -------8<------------------------
-struct Graph {
-    const int n;
-    std::vector<std::vector<int>> adj;
-    explicit Graph(int _n) : n(_n), adj(n) {}
-    void add_edge(int u, int v) { adj[u].push_back(v); adj[v].push_back(u); }
-};
-
-bool IsBipartite(const Graph &g) {
-    enum class Color : char { Red, Blue, UNCOLOR };
-    std::vector<Color> color(g.n, Color::UNCOLOR);
-
-    std::function<bool(int, Color)> Dfs = [&](int v, Color c) {
-        color[v] = c;
-        Color diff_c = (c == Color::Red ? Color::Blue : Color::Red);
-        for (const int u : g.adj[v]) {
-            if (color[u] == c) return false;
-            if (color[u] == Color::UNCOLOR && !Dfs(u, diff_c)) return false;
-        }
-        return true;
-    };
+//  @require ./csr_graph.cc 👇👇
+//  @require ./bfs_direction_optimizing.cc 👇👇
 
+// -------------8<------- start of library -------8<------------------------
+template<class T>
+bool IsBipartite(const CsrGraph<T> &g, int p = std::max(1u, std::thread::hardware_concurrency())) {
+    DirectionOptimizingBfs<T> bfs(g, p);
+    bfs.RunAll();
     for (int v = 0; v < g.n; ++v)
-        if (color[v] == Color::UNCOLOR && !Dfs(v, Color::Red)) return false;
+        for (int u : g.adj(v))
+            if (bfs.dist[v] % 2 == bfs.dist[u] % 2) return false;
     return true;
 }
 // -------------8<------- end of library ---------8-------------------------
@@ -69,11 +59,12 @@ int main() {
     int n, m, v[2];
     std::cin >> n >> m;
 
-    Graph g(n);
+    CsrGraph<> g(n);
     for (int i = 0; i < m; ++i) {
         std::cin >> v[0] >> v[1];
         g.add_edge(v[0], v[1]);
     }
+    g.build();
 
     std::cout << (IsBipartite(g) ? "Yes " : "No ") << "Bipartite Graph\n";
 
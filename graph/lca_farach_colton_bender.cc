@@ -0,0 +1,200 @@
+/*
+  Lowest Common Ancestor by block decomposition RMQ (Farach-Colton and Bender)
+  最小共通祖先（ブロック分割による RMQ，Farach-Colton と Bender の方法）
+  ==========================================================================
+
+  # Problem
+    Input: 根付き木 (T = (V, E), r)
+    Query: T の頂点 u, v --> u と v の最小共通祖先
+
+    Def. 最小共通祖先(Lowest Common Ancestor) -> graph/lca_euler_tour.cc
+
+  # Complexity (n = |V|, q = クエリ数, p = スレッド数)
+    Time:
+      + 前処理: O(n)
+      + クエリ: O(1)（一括クエリは O(q / p)）
+    Space: O(n)
+
+  # Usage
+    - LowestCommonAncestor lca(n, r): 頂点数 n, 根のラベル r の根付き木を構成
+    - lca.add_edge(u, v): 辺 {u, v} を追加
+    - lca.Preprocessing(): クエリに対する前処理（辺の追加はこれ以前のみ．再度呼んでもよい）
+    - lca.query(u, v): u と v の最小共通祖先を求める
+    - lca.query(pairs, p): 各 pairs[i] = (u, v) の最小共通祖先 res[i] を p スレッドで求める
+      （p を省略するとコア数）
+
+    - lca.tin[v]: 行きがけ順での v の番号, lca.order[i]: 行きがけ順で i 番目の頂点
+
+  # Description
+    graph/lca_euler_tour.cc と同じく LCA を区間最小値（RMQ）に帰着させるが，長さ 2n - 1 の
+    オイラーツアーの代わりに長さ n の行きがけ順（DFS 順）を使う．v の行きがけ順の番号を tin(v)，
+    v の親を par(v) として，各 i = 1, ..., n - 1 に val(i) = tin(par(order(i))) とおく．
+    u != v, tin(u) < tin(v) のとき，u と v の最小共通祖先 w について
+      + 区間 (tin(u), tin(v)] の頂点はすべて w の部分木に含まれるので val >= tin(w)
+      + w から v へ向かう子 c は区間に含まれて val(tin(c)) = tin(w)
+    が成り立つので，w = order(min{val(i) : tin(u) < i <= tin(v)}) となる．
+
+    RMQ は長さ B = 64 のブロックに分けて答える．
+      + ブロックをまたぐ部分は，各ブロックの最小値からなる長さ n / B の列の sparse table
+        （data_structure/sparse_table_RmQ_RMQ.cc）で求める．大きさは O((n / B) log n) = O(n)
+      + ブロック内の区間 [l, r] は，ブロックの先頭から r までを走査したときの単調スタック
+        （最小値の候補）に入っている位置のビットマスク mask(r) を持っておくと，
+        mask(r) の l 以上のビットのうち最も下のビットの位置が最小値の位置になる
+    クエリはビット演算と sparse table の参照が定数回なので O(1) 時間になる．
+
+    一括クエリではクエリ列を p 個の連続した区間に分けて各スレッドで処理する．
+
+  # Note
+    - 木は CSR 形式（graph/csr_graph.cc）で持ち，探索は再帰しないので，深さが 10^6 を超える木
+      （パスグラフなど）でもスタックオーバーフローしない
+    - Farach-Colton と Bender の元の方法はオイラーツアーの ±1 性を使ってブロックの種類ごとに
+      表を作るが，ここではビットマスクによるブロック内 RMQ を使っている
+    - 一括クエリで q < PARALLEL_THRESHOLD のときは1スレッドで処理する
+
+  # References
+    - M. A. Bender and M. Farach-Colton (2000): The LCA problem revisited.
+      In Proceedings of LATIN 2000, pp. 88--94.
+    - [cp-algorithms: Lowest Common Ancestor - Farach-Colton and Bender Algorithm]
+      (https://cp-algorithms.com/graph/lca_farachcoltonbender.html)
+    - [@codeforces: O(n) preprocessing, O(1) query RMQ]
+      (https://codeforces.com/blog/entry/78931)
+
+  # Verified
+    - [AOJ GRL_5_C Tree - Lowest Common Ancestor]
+      (http://judge.u-aizu.ac.jp/onlinejudge/description.jsp?id=GRL_5_C)
+*/
+
+#include <iostream>
+#include <vector>
+#include <tuple>
+#include <algorithm>
+#include <thread>
+#include <cassert>
+
+//  @require ./csr_graph.cc 👇👇
+
+// -------------8<------- start of library -------8<------------------------
+struct LowestCommonAncestor {
+    static constexpr int B = 64;                      // block size
+    static constexpr int PARALLEL_THRESHOLD = 1 << 16;
+    const int root, n;
+    CsrGraph<int> g;
+    std::vector<int> tin, order, val, table;          // table[k * nb + b]: min of the blocks [b, b + 2^k)
+    std::vector<unsigned long long> mask;
+    int nb;
+
+    explicit LowestCommonAncestor(int _n, int _r = 0) : root(_r), n(_n), g(n) {}
+
+    void add_edge(int u, int v) { g.add_edge(u, v); }
+
+    void Preprocessing() {
+        if ((int)g.head.size() != n + 1) g.build();
+        tin.assign(n, -1); order.clear(); order.reserve(n);
+        val.assign(n, 0);
+
+        // preorder by an iterative DFS
+        std::vector<int> par(n, -1), iter(g.head.begin(), g.head.end() - 1), stk(1, root);
+        tin[root] = 0; order.push_back(root);
+        while (!stk.empty()) {
+            const int v = stk.back();
+            if (iter[v] == g.head[v + 1]) { stk.pop_back(); continue; }
+            const int u = g.to[iter[v]++];
+            if (u == par[v]) continue;
+            par[u] = v;
+            tin[u] = order.size(); order.push_back(u);
+            val[tin[u]] = tin[v];
+            stk.push_back(u);
+        }
+        assert((int)order.size() == n);
+
+        // in-block bitmasks of the monotone stacks
+        mask.resize(n);
+        for (int bs = 0; bs < n; bs += B) {
+            unsigned long long cur = 0;
+            for (int i = bs; i < std::min(n, bs + B); ++i) {
+                while (cur && val[i] <= val[bs + 63 - __builtin_clzll(cur)])
+                    cur ^= 1ULL << (63 - __builtin_clzll(cur));
+                cur |= 1ULL << (i - bs);
+                mask[i] = cur;
+            }
+        }
+
+        // sparse table over the minima of the blocks
+        nb = (n + B - 1) / B;
+        const int levels = 32 - __builtin_clz(nb);
+        table.resize(levels * nb);
+        for (int b = 0; b < nb; ++b) table[b] = InBlock(b * B, std::min(n, b * B + B) - 1);
+        for (int k = 1; k < levels; ++k)
+            for (int b = 0; b + (1 << k) <= nb; ++b)
+                table[k * nb + b] = std::min(table[(k - 1) * nb + b],
+                                             table[(k - 1) * nb + b + (1 << (k - 1))]);
+    }
+
+    int query(int u, int v) const {
+        if (u == v) return u;
+        int l = tin[u], r = tin[v];
+        if (r < l) std::swap(l, r);
+        return order[rmq(l + 1, r)];
+    }
+
+    std::vector<int> query(const std::vector<std::pair<int, int>> &pairs,
+                           int p = std::max(1u, std::thread::hardware_concurrency())) const {
+        const int q = pairs.size();
+        std::vector<int> res(q);
+        auto worker = [&](const int first, const int last) {
+            for (int i = first; i < last; ++i) res[i] = query(pairs[i].first, pairs[i].second);
+        };
+        if (q < PARALLEL_THRESHOLD) p = 1;
+        std::vector<std::thread> th;
+        for (int k = 1; k < p; ++k) th.emplace_back(worker, (long long)q * k / p, (long long)q * (k + 1) / p);
+        worker(0, q / p);
+        for (auto &t : th) t.join();
+        return res;
+    }
+
+private:
+    // minimum of val[l..r] in the same block
+    int InBlock(const int l, const int r) const {
+        return val[l + __builtin_ctzll(mask[r] >> (l % B))];
+    }
+
+    // minimum of val[l..r]
+    int rmq(const int l, const int r) const {
+        const int bl = l / B, br = r / B;
+        if (bl == br) return InBlock(l, r);
+        int res = std::min(InBlock(l, bl * B + B - 1), InBlock(br * B, r));
+        if (bl + 1 < br) {
+            const int k = 31 - __builtin_clz(br - bl - 1);
+            res = std::min({res, table[k * nb + bl + 1], table[k * nb + br - (1 << k)]});
+        }
+        return res;
+    }
+};
+// -------------8<------- end of library ---------8-------------------------
+
+int main() {
+    std::cin.tie(0); std::ios::sync_with_stdio(false);
+
+    // AOJ GRL_5_C: Tree - Lowest Common Ancestor
+    int n;
+    std::cin >> n;
+
+    LowestCommonAncestor lca(n, 0);
+    for (int v = 0, deg, c; v < n; ++v) {
+        std::cin >> deg;
+        while (deg--) {
+            std::cin >> c;
+            lca.add_edge(v, c);
+        }
+    }
+    lca.Preprocessing();
+
+    int q;
+    std::cin >> q;
+    std::vector<std::pair<int, int>> pairs(q);
+    for (auto &p : pairs) std::cin >> p.first >> p.second;
+
+    for (const int w : lca.query(pairs)) std::cout << w << '\n';
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+/*
+  Offline Lowest Common Ancestor by Tarjan
+  最小共通祖先（Tarjan のオフラインアルゴリズム）
+  ===============================================
+
+  # Problem
+    Input: 根付き木 (T = (V, E), r), 頂点の組の列 (u_1, v_1), ..., (u_q, v_q)
+    Output: 各 i に対して u_i と v_i の最小共通祖先
+
+    Def. 最小共通祖先(Lowest Common Ancestor) -> graph/lca_euler_tour.cc
+
+  # Complexity (n = |V|, q = クエリ数)
+    Time: O((n + q) α(n))
+    Space: O(n + q)
+
+  # Usage
+    - OfflineLowestCommonAncestor lca(n, r): 頂点数 n, 根のラベル r の根付き木を構成
+    - lca.add_edge(u, v): 辺 {u, v} を追加
+    - lca.query(pairs): 各 pairs[i] = (u, v) の最小共通祖先 res[i] を返す
+
+  # Description
+    すべてのクエリが最初に与えられるときは，1回の深さ優先探索ですべてのクエリに答えられる．
+    探索中の頂点を訪問済みの頂点の集合に union-find（data_structure/union_find.cc）で分割して，
+    各集合の代表元に anc（その集合の頂点の祖先で，探索中のパス上にあるもの）を持たせる．
+      + 頂点 v に入ったら {v} を新しい集合として anc = v とする
+      + v の子 c の探索を終えたら c の集合を v の集合に併合して anc = v とする
+      + v の部分木の探索を終えたら，v を含むクエリ (v, w) で w が訪問済みのものに
+        anc(find(w)) と答える
+    w が訪問済みならば，w の集合の anc は w の祖先でパス上にある最も深い頂点であり，v も
+    その頂点の部分木に含まれるので，これが v と w の最小共通祖先になる．
+
+    クエリは頂点ごとに計数ソートで並べた配列（CSR 形式）に持つので，追加のメモリは O(n + q)
+    である．部分木の探索を終えた時点で処理を行うので，探索は各頂点の次に見る辺の位置 iter[v] を
+    持つ明示的なスタックで行う．
+
+  # Note
+    - クエリを先読みできない場合は graph/lca_farach_colton_bender.cc（前処理 O(n), クエリ O(1)）
+    - 比較は compare_speed_cpp/lca.cc を参照
+
+  # References
+    - R. E. Tarjan (1979): Applications of path compression on balanced trees.
+      Journal of the ACM, 26(4), pp. 690--715.
+    - H. N. Gabow and R. E. Tarjan (1983): A linear-time algorithm for a special case of
+      disjoint set union. In Proceedings of STOC 1983, pp. 246--251.
+    - [Wikipedia: Tarjan's off-line lowest common ancestors algorithm]
+      (https://en.wikipedia.org/wiki/Tarjan%27s_off-line_lowest_common_ancestors_algorithm)
+
+  # Verified
+    - [AOJ GRL_5_C Tree - Lowest Common Ancestor]
+      (http://judge.u-aizu.ac.jp/onlinejudge/description.jsp?id=GRL_5_C)
+*/
+
+#include <iostream>
+#include <vector>
+#include <tuple>
+#include <cassert>
+
+//  @require ./csr_graph.cc 👇👇
+//  @require ../data_structure/union_find.cc 👇👇
+
+// -------------8<------- start of library -------8<------------------------
+struct OfflineLowestCommonAncestor {
+    const int root, n;
+    CsrGraph<int> g;
+
+    explicit OfflineLowestCommonAncestor(int _n, int _r = 0) : root(_r), n(_n), g(n) {}
+
+    void add_edge(int u, int v) { g.add_edge(u, v); }
+
+    std::vector<int> query(const std::vector<std::pair<int, int>> &pairs) {
+        if ((int)g.head.size() != n + 1) g.build();
+        const int q = pairs.size();
+
+        // the queries of each vertex in CSR form
+        std::vector<int> qhead(n + 1, 0), qid(2 * q);
+        for (const auto &p : pairs) { ++qhead[p.first + 1]; ++qhead[p.second + 1]; }
+        for (int v = 0; v < n; ++v) qhead[v + 1] += qhead[v];
+        {
+            std::vector<int> pos(qhead.begin(), qhead.end() - 1);
+            for (int i = 0; i < q; ++i) { qid[pos[pairs[i].first]++] = i; qid[pos[pairs[i].second]++] = i; }
+        }
+
+        std::vector<int> res(q, -1), anc(n), par(n, -1), iter(g.head.begin(), g.head.end() - 1), stk(1, root);
+        std::vector<char> visited(n, false);
+        UnionFind uf(n);
+        visited[root] = true; anc[root] = root;
+        while (!stk.empty()) {
+            const int v = stk.back();
+            if (iter[v] < g.head[v + 1]) {
+                const int u = g.to[iter[v]++];
+                if (u == par[v]) continue;
+                par[u] = v; visited[u] = true; anc[u] = u;
+                stk.push_back(u);
+                continue;
+            }
+
+            // the subtree of v is finished
+            for (int j = qhead[v]; j < qhead[v + 1]; ++j) {
+                const int i = qid[j], w = pairs[i].first ^ pairs[i].second ^ v;
+                if (visited[w]) res[i] = anc[uf.root(w)];
+            }
+            stk.pop_back();
+            if (0 <= par[v]) { uf.unite(par[v], v); anc[uf.root(v)] = par[v]; }
+        }
+        return res;
+    }
+};
+// -------------8<------- end of library ---------8-------------------------
+
+int main() {
+    std::cin.tie(0); std::ios::sync_with_stdio(false);
+
+    // AOJ GRL_5_C: Tree - Lowest Common Ancestor
+    int n;
+    std::cin >> n;
+
+    OfflineLowestCommonAncestor lca(n, 0);
+    for (int v = 0, deg, c; v < n; ++v) {
+        std::cin >> deg;
+        while (deg--) {
+            std::cin >> c;
+            lca.add_edge(v, c);
+        }
+    }
+
+    int q;
+    std::cin >> q;
+    std::vector<std::pair<int, int>> pairs(q);
+    for (auto &p : pairs) std::cin >> p.first >> p.second;
+
+    for (const int w : lca.query(pairs)) std::cout << w << '\n';
+
+    return 0;
+}
@@ -0,0 +1,165 @@
+/*
+  Bridges, Articulation Points and Biconnected Components (iterative lowlink)
+  橋・関節点・2辺連結成分・2点連結成分（再帰を使わない lowlink）
+  ===========================================================================
+
+  # Problem
+    Input: 無向グラフ G = (V, E)（多重辺・自己ループがあってもよい）
+    Output: G のすべての橋と関節点，2辺連結成分と2点連結成分
+
+    Def. 橋(bridge), 2辺連結成分 -> graph/bridge.cc
+    Def. 関節点(articulation point), 2点連結成分 -> graph/articulation_point.cc
+
+  # Complexity (n = |V|, m = |E|)
+    Time: O(n + m)
+    Memory: O(n + m)
+
+  # Usage
+    - CsrGraph<T> g(n): 頂点数 n のグラフ（graph/csr_graph.cc）
+    - g.add_edge(u, v), g.build(): 辺 {u, v} を追加して隣接配列を構築（辺番号は追加した順番）
+    - Lowlink<T> ll(g): g の lowlink を計算する
+    - ll.Bridge(): 橋の数を返す
+      + ll.bridge[i]: i 番目の橋の辺番号, ll.is_bridge[e]: 辺 e が橋かどうか
+      + ll.ecomp[v]: 頂点 v が属する2辺連結成分の番号（0, 1, ..., 橋の数 + 連結成分数 - 1）
+    - ll.ArticulationPoints(): 関節点の数を返す
+      + ll.art[i]: i 番目の関節点, ll.is_art[v]: 頂点 v が関節点かどうか
+    - ll.BiconnectedComponent(): 2点連結成分の数を返す
+      + ll.vcomp[e]: 辺 e が属する2点連結成分の番号（自己ループは -1）
+    - ll.ord[v], ll.low[v]: 頂点 v の DFS での訪問順と lowlink
+    - ll.parent[v], ll.parent_edge[v]: DFS 木での v の親とその辺の番号（根では -1）
+
+  # Description
+    lowlink の定義と橋・関節点の条件は graph/bridge.cc, graph/articulation_point.cc と同じ．
+    再帰による DFS は深さ n のグラフ（パスに近いグラフ）でスタックが溢れるので，
+    頂点ごとに次に調べる弧の位置 it[v] を持って明示的なスタックで DFS を行う．
+    v の弧を調べ終えてスタックから取り除くときに，親 p について low[p] を更新して
+    ord[p] < low[v] なら辺 (p, v) は橋，ord[p] <= low[v] なら p は関節点の候補である．
+    DFS 木の辺は辺番号で判定するので多重辺も正しく扱える．
+
+    2点連結成分は辺の分割として求める．木の辺と後退辺を初めて調べたときに辺のスタックに
+    積み，v を取り除くときに ord[p] <= low[v] ならスタックから辺 (p, v) までを取り出して
+    1つの2点連結成分とする．
+    2辺連結成分は橋を除いたグラフの連結成分なので，DFS の訪問順に頂点を見て，親への辺が
+    橋でなければ親と同じ番号，そうでなければ新しい番号を付ける．
+    結果は頂点または辺で添字付けられた配列で返す．
+
+  # Note
+    - 比較は compare_speed_cpp/lowlink.cc を参照
+
+  # References
+    - [保坂和宏，グラフ探索アルゴリズムとその応用](http://hos.ac/slides/20110504_graph.pdf)
+    - R. E. Tarjan (1972): Depth-first search and linear graph algorithms.
+      SIAM Journal on Computing, 1(2), pp. 146--160.
+
+  # Verified
+    - graph/bridge.cc, graph/articulation_point.cc とランダムグラフ上で比較
+*/
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+//  @require ./csr_graph.cc 👇👇
+
+// -------------8<------- start of library -------8<------------------------
+template<class T = int>
+struct Lowlink {
+    const CsrGraph<T> &g;
+    std::vector<int> ord, low, parent, parent_edge;
+    std::vector<int> bridge, art, ecomp, vcomp;
+    std::vector<char> is_bridge, is_art;
+
+    explicit Lowlink(const CsrGraph<T> &_g)
+        : g(_g), ord(g.n, -1), low(g.n), parent(g.n, -1), parent_edge(g.n, -1),
+          vcomp(g.m, -1), is_bridge(g.m, false), is_art(g.n, false) {
+        Dfs();
+    }
+
+    int Bridge() const { return bridge.size(); }
+    int ArticulationPoints() const { return art.size(); }
+    int BiconnectedComponent() const { return num_vcomp; }
+
+private:
+    int num_vcomp = 0;
+
+    void Dfs() {
+        std::vector<int> it(g.head.begin(), g.head.end() - 1), order, stack, estack;
+        order.reserve(g.n);
+        for (int r = 0, idx = 0; r < g.n; ++r) {
+            if (ord[r] != -1) continue;
+            int children = 0;
+            ord[r] = low[r] = idx++;
+            order.push_back(r);
+            stack.push_back(r);
+            while (!stack.empty()) {
+                const int v = stack.back();
+                if (it[v] < g.head[v + 1]) {
+                    const int i = it[v]++, u = g.to[i], e = g.id[i];
+                    if (e == parent_edge[v] || u == v) continue;
+                    if (ord[u] == -1) {
+                        parent[u] = v; parent_edge[u] = e;
+                        ord[u] = low[u] = idx++;
+                        order.push_back(u);
+                        stack.push_back(u);
+                        estack.push_back(e);
+                        if (v == r) ++children;
+                    }
+                    else if (ord[u] < ord[v]) {
+                        low[v] = std::min(low[v], ord[u]);
+                        estack.push_back(e);
+                    }
+                    continue;
+                }
+
+                stack.pop_back();
+                const int p = parent[v];
+                if (p == -1) continue;
+                low[p] = std::min(low[p], low[v]);
+                if (ord[p] < low[v]) { is_bridge[parent_edge[v]] = true; bridge.push_back(parent_edge[v]); }
+                if (ord[p] <= low[v]) {
+                    if (p != r && !is_art[p]) { is_art[p] = true; art.push_back(p); }
+                    while (true) {
+                        const int e = estack.back(); estack.pop_back();
+                        vcomp[e] = num_vcomp;
+                        if (e == parent_edge[v]) break;
+                    }
+                    ++num_vcomp;
+                }
+            }
+            if (1 < children) { is_art[r] = true; art.push_back(r); }
+        }
+
+        ecomp.assign(g.n, -1);
+        int k = 0;
+        for (int v : order) {
+            const int e = parent_edge[v];
+            ecomp[v] = (e == -1 || is_bridge[e]) ? k++ : ecomp[parent[v]];
+        }
+    }
+};
+// -------------8<------- end of library ---------8-------------------------
+
+int main() {
+    std::cin.tie(0); std::ios::sync_with_stdio(false);
+
+    int n, m;
+    std::cin >> n >> m;
+
+    CsrGraph<> g(n);
+    std::vector<std::pair<int, int>> edges(m);
+    for (auto &e : edges) {
+        std::cin >> e.first >> e.second;
+        g.add_edge(e.first, e.second);
+    }
+    g.build();
+
+    Lowlink<> ll(g);
+
+    // Output for AOJ GRL_3_B: Bridge
+    std::vector<std::pair<int, int>> res;
+    for (int e : ll.bridge) res.emplace_back(std::minmax(edges[e].first, edges[e].second));
+    std::sort(res.begin(), res.end());
+    for (auto e : res) std::cout << e.first << ' ' << e.second << '\n';
+
+    return 0;
+}
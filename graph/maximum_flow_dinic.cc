@@ -7,16 +7,22 @@
     Input: 有向グラフ G = (V, A), 容量 c : A -> R, s, t \in V
     Output: s から t へ至る流れで，その値が最大のもの
 
-  # Complexity (n = |V|, m = |A|)
-    - Time: O(m n^2)
+  # Complexity (n = |V|, m = |A|, U = 最大の容量)
+    - Time: O(m n^2)（容量スケーリングを使うと O(n m log U)）
     - Space: O(n + m)
 
   # Usage
     - Dinic<T> g(n, inf): 弧重みの型 T, 頂点数 n, 容量無限大の値が inf の有向グラフを構築
     - Dinic<T> g(n): 弧重みの型 T，頂点数 n の有向グラフを構築（容量無限大は T の最大値 / 10 に設定）
-    - g.add_arc(u, v, c): 容量 c の弧 (u, v) を追加
+    - g.add_arc(u, v, c): 容量 c の弧 (u, v) を追加して，弧の番号（0, 1, 2, ...）を返す
     - g.add_edge(u, v, c): 容量 c の辺 {u, v} を追加
     - g.MaximumFlow(s, t): s から t へ至る最大流の値
+    - g.MaximumFlow(s, t, true): 容量スケーリングを使って s から t へ至る最大流の値を求める（整数の容量のみ）
+    - g.Flow(i), g.Capacity(i): add_arc が返した番号 i の弧の流量と容量
+    - g.UpdateCapacity(i, c): 弧 i の容量を c に変更して，前回の MaximumFlow(s, t) の流れを修復する．
+      流量の値が減った分を返す（続けて g.MaximumFlow(s, t) を呼ぶと追加で流せる量を返す）
+    - g.MinimumCut(): 前回の MaximumFlow(s, t) に対する最小カットの s 側の頂点集合（side[v] = true）
+    - g.CutArcs(): 最小カットに含まれる弧の番号のリスト
 
   # Description
   　現在の流れ f の補助ネットワークに対して入口 s から幅優先探索を行う．s から頂点 v への距離（弧数）を
@@ -28,10 +34,31 @@
 
   　ディニッツのアルゴリズムはフォード・ファルカーソン法と異なり強多項式時間アルゴリズムである．
 
+  　i 番目に追加した弧に番号 2i, その逆向きの弧に番号 2i + 1 を付ける（弧 a の逆向きの弧は a ^ 1）．
+  　弧の終点・逆向きの弧の位置・残余容量は始点の順に並べた1本の配列（CSR 形式）に格納して，
+  　頂点 v から出る弧は位置 head[v], ..., head[v + 1] - 1 に連続して並ぶ．弧の番号 a の位置は pos[a]．
+  　配列は最初の MaximumFlow で構築する（弧を追加した後に呼ぶと残余容量を保ったまま構築し直す）．
+  　level, iter, キュー, 道のスタックはフェーズ間で使い回す．ブロッキングフローは再帰を使わずに，
+  　s から t への道をスタックに積んで，t に着いたら最初に飽和した弧の始点まで戻って探索を続ける．
+  　行き止まりの頂点は level を -1 にして二度と訪れない．
+
+  　容量スケーリングでは Δ を最大の容量以下の 2 のべき乗から始めて，残余容量が Δ 以上の弧だけで
+  　ディニッツのアルゴリズムを行い，Δ を半分にすることを Δ = 1 まで繰り返す．
+  　各 Δ での増加量は小さいので，容量の大きさが大きく異なるネットワークで増加の回数が減る．
+
+  　容量の変更（UpdateCapacity）: 容量を増やす場合や流量以上の値に減らす場合は残余容量を変えるだけでよい．
+  　流量 f より小さい c に減らすと，弧 (u, v) の流量を c にしたことで u に f - c の超過，v に f - c の不足が
+  　生じる．まず残余ネットワークで u から v へ f - c まで流して迂回させ，残った超過は u から s へ
+  　（足りなければ t へ），不足は s から v へ（足りなければ t から）流して解消する．得られる流れは
+  　実行可能なので，続けて MaximumFlow(s, t) を呼ぶと前回の残余ネットワークから増やせる分だけを求める
+  　（最初から解き直さない）．
+
   # Note
     - g.INF の値を問題ごとに適切に割り当てないとオーバーフローする可能性がある
     - 容量がすべて1ならば計算時間は O(min{n^{2/3}, m^{1/2}} m)
     - 無向辺を加えるときは，両方向に容量 c の弧を加える（add_edge を使用）
+    - 同じインターフェースのプッシュ・再ラベル法は graph/maximum_flow_push_relabel.cc
+    - 以前の隣接リストと再帰による実装との比較は compare_speed_cpp/maximum_flow_dinic.cc を参照
 
   # References
     - あり本. pp. 188--195
@@ -46,31 +73,29 @@
 
 #include <iostream>
 #include <vector>
-#include <queue>
 #include <limits>
+#include <algorithm>
+#include <tuple>
 
 // -------------------8<------- start of library -------8<------------------------
 template<typename Weight>
 struct Dinic {
     using weight_type = Weight;
 
-    struct Edge {
-        int src, dst, rev;
-        Weight weight;
-        Edge(int f, int t, Weight cap, int rev = 0) :
-            src(f), dst(t), rev(rev), weight(cap) {}
-    };
-
     int n;
-    std::vector<std::vector<Edge>> adj;
     const Weight INF;
+    // arcs leaving v are at positions head[v], ..., head[v + 1] - 1 (rev[i]: the reverse arc)
+    std::vector<int> head, to, rev;
+    std::vector<Weight> residual;
+    // pos[2i]: position of the i-th added arc, pos[2i + 1]: position of its reverse arc
+    std::vector<int> pos;
 
     explicit Dinic(int _n, Weight inf = std::numeric_limits<Weight>::max() / 10)
-        : n(_n), adj(n), INF(inf) {}
+        : n(_n), INF(inf) {}
 
-    void add_arc(const int src, const int dst, const Weight cap) {
-        adj[src].emplace_back(Edge(src, dst, cap, adj[dst].size()));
-        adj[dst].emplace_back(Edge(dst, src, 0, adj[src].size() - 1));
+    int add_arc(const int src, const int dst, const Weight cap) {
+        pending.emplace_back(src, dst, cap);
+        return pos.size() / 2 + pending.size() - 1;
     }
 
     void add_edge(const int src, const int dst, const Weight cap) {
@@ -78,50 +103,169 @@ struct Dinic {
         add_arc(dst, src, cap);
     }
 
-    Weight MaximumFlow(const int s, const int t) {
-        Weight flow = 0;
-        while(true) {
-            std::vector<int> level(n, -1);
-            LevelGraph(s, level);
-            if(level[t] == -1) break;
-
-            std::vector<size_t> iter(n);
-            Weight blocking_flow = 0;
-            while ((blocking_flow = AugmentingPath(s, INF, t, level, iter)) > 0)
-                flow += blocking_flow;
+    Weight MaximumFlow(const int s, const int t, const bool scaling = false) {
+        last_s = s; last_t = t;
+        return Augment(s, t, INF, scaling);
+    }
+
+    Weight Flow(const int i) { Build(); return residual[pos[2 * i + 1]]; }
+    Weight Capacity(const int i) { Build(); return residual[pos[2 * i]] + residual[pos[2 * i + 1]]; }
+
+    // returns how much the value of the flow of the last MaximumFlow(s, t) decreased
+    Weight UpdateCapacity(const int i, const Weight cap) {
+        Build();
+        const int a = pos[2 * i], u = to[rev[a]], v = to[a];
+        const Weight f = residual[rev[a]];
+        if (f <= cap || last_s == -1) {
+            residual[a] = cap - std::min(f, cap); residual[rev[a]] = std::min(f, cap);
+            return 0;
+        }
+        residual[a] = 0; residual[rev[a]] = cap;
+
+        // u has excess f - cap and v has deficit f - cap
+        const int s = last_s, t = last_t;
+        Weight d = f - cap, change = (u == t ? d : 0) - (v == t ? d : 0);
+        auto send = [&](const int x, const int y, const Weight lim) {
+            if (lim <= 0 || x == y) return Weight(0);
+            const Weight r = Augment(x, y, lim, false);
+            change += (y == t ? r : 0) - (x == t ? r : 0);
+            return r;
+        };
+        d -= send(u, v, d);
+        Weight ex = (u == s || u == t ? 0 : d), de = (v == s || v == t ? 0 : d);
+        ex -= send(u, s, ex); send(u, t, ex);
+        de -= send(s, v, de); send(t, v, de);
+        return -change;
+    }
+
+    // source side of a minimum cut of the last MaximumFlow (is_source_side[v])
+    std::vector<char> MinimumCut() {
+        Build();
+        std::vector<char> side(n, false);
+        if (last_s == -1) return side;
+        int qh = 0, qt = 0;
+        side[last_s] = true; que[qt++] = last_s;
+        while (qh < qt) {
+            const int v = que[qh++];
+            for (int i = head[v]; i < head[v + 1]; ++i)
+                if (!side[to[i]] && 0 < residual[i]) { side[to[i]] = true; que[qt++] = to[i]; }
+        }
+        return side;
+    }
+
+    // arcs (numbers returned by add_arc) from the source side to the sink side
+    std::vector<int> CutArcs() {
+        const std::vector<char> side = MinimumCut();
+        std::vector<int> res;
+        for (int i = 0; i < (int)pos.size() / 2; ++i)
+            if (side[to[rev[pos[2 * i]]]] && !side[to[pos[2 * i]]]) res.push_back(i);
+        return res;
+    }
+
+private:
+    int last_s = -1, last_t = -1;
+    std::vector<std::tuple<int, int, Weight>> pending;  // arcs added after the last Build
+    std::vector<int> level, iter, que, path;
+
+    Weight Augment(const int s, const int t, const Weight limit, const bool scaling) {
+        if (s == t) return 0;
+        Build();
+
+        Weight delta = 1;
+        if (scaling && std::numeric_limits<Weight>::is_integer) {
+            Weight max_cap = 0;
+            for (const Weight c : residual) max_cap = std::max(max_cap, c);
+            while (delta <= max_cap / 2) delta *= 2;
         }
 
+        Weight flow = 0;
+        for (; ; delta /= 2) {
+            while (flow < limit && LevelGraph(s, t, delta)) flow += BlockingFlow(s, t, delta, limit - flow);
+            if (!std::numeric_limits<Weight>::is_integer || delta <= 1) break;
+        }
         return flow;
     }
 
-    void LevelGraph(const int s, std::vector<int> &level){
-        std::queue<int> que;
-        for (level[s] = 0, que.push(s); !que.empty(); ) {
-            const int v = que.front(); que.pop();
-            for (const auto &e : adj[v])
-                if(0 < e.weight && level[e.dst] == -1){
-                    level[e.dst] = level[v] + 1;
-                    que.push(e.dst);
-                }
+    // (re)builds the arrays when arcs are added (the residual capacities are kept)
+    void Build() {
+        if ((int)head.size() == n + 1 && pending.empty()) return;
+        const int old = pos.size(), m = old + 2 * pending.size();
+        std::vector<int> src(m), dst(m);
+        std::vector<Weight> cap(m);
+        for (int a = 0; a < old; ++a) {
+            src[a] = to[pos[a ^ 1]]; dst[a] = to[pos[a]]; cap[a] = residual[pos[a]];
+        }
+        for (int a = old; a < m; a += 2) {
+            std::tie(src[a], dst[a], cap[a]) = pending[(a - old) / 2];
+            src[a + 1] = dst[a]; dst[a + 1] = src[a]; cap[a + 1] = 0;
         }
+        std::vector<std::tuple<int, int, Weight>>().swap(pending);
+
+        head.assign(n + 1, 0);
+        for (int v : src) ++head[v + 1];
+        for (int v = 0; v < n; ++v) head[v + 1] += head[v];
+        std::vector<int> next(head.begin(), head.end() - 1);
+        pos.resize(m); to.resize(m); rev.resize(m); residual.resize(m);
+        for (int a = 0; a < m; ++a) pos[a] = next[src[a]]++;
+        for (int a = 0; a < m; ++a) {
+            to[pos[a]] = dst[a]; rev[pos[a]] = pos[a ^ 1]; residual[pos[a]] = cap[a];
+        }
+        level.resize(n); iter.resize(n); que.resize(n);
+    }
+
+    // an arc is usable when its residual capacity is at least delta (delta = 1: positive)
+    bool Usable(const int i, const Weight delta) const {
+        return std::numeric_limits<Weight>::is_integer ? delta <= residual[i] : 0 < residual[i];
     }
 
-    Weight AugmentingPath(int v, Weight flow, const int t,
-                          std::vector<int> &level, std::vector<size_t> &iter) {
-        if(v == t) return flow;
-        for ( ; iter[v] < adj[v].size(); ++iter[v]) {
-            Edge &e = adj[v][iter[v]];
-
-            if(0 < e.weight && level[v] < level[e.dst]){
-                Weight d = AugmentingPath(e.dst, std::min(flow, e.weight), t, level, iter);
-                if(0 < d){
-                    e.weight -= d;
-                    adj[e.dst][e.rev].weight += d;
-                    return d;
-                }
+    bool LevelGraph(const int s, const int t, const Weight delta) {
+        std::fill(level.begin(), level.end(), -1);
+        int qh = 0, qt = 0;
+        level[s] = 0; que[qt++] = s;
+        while (qh < qt && level[t] == -1) {
+            const int v = que[qh++];
+            for (int i = head[v]; i < head[v + 1]; ++i)
+                if (level[to[i]] == -1 && Usable(i, delta)) { level[to[i]] = level[v] + 1; que[qt++] = to[i]; }
+        }
+        return level[t] != -1;
+    }
+
+    // augments along level-increasing paths without recursion until no such path remains
+    Weight BlockingFlow(const int s, const int t, const Weight delta, const Weight limit) {
+        std::copy(head.begin(), head.end() - 1, iter.begin());
+        Weight flow = 0;
+        path.clear();
+        for (int v = s; ; ) {
+            if (v == t) {
+                Weight f = limit - flow;
+                for (int i : path) f = std::min(f, residual[i]);
+                for (int i : path) { residual[i] -= f; residual[rev[i]] += f; }
+                flow += f;
+                if (flow == limit) break;
+                // retreats to the tail of the first saturated arc
+                std::size_t k = 0;
+                while (Usable(path[k], delta)) ++k;
+                path.resize(k);
+                v = (k == 0 ? s : to[path[k - 1]]);
+                continue;
             }
+
+            int &i = iter[v];
+            while (i < head[v + 1] && !(Usable(i, delta) && level[to[i]] == level[v] + 1)) ++i;
+            if (i < head[v + 1]) {
+                path.push_back(i);
+                v = to[i];
+                continue;
+            }
+
+            // dead end
+            if (v == s) break;
+            level[v] = -1;
+            v = to[rev[path.back()]];
+            path.pop_back();
+            ++iter[v];
         }
-        return 0;
+        return flow;
     }
 };
 // ------------------8<------- end of library ---------8-------------------------
@@ -14,9 +14,14 @@
   # Usage
     - FordFulkerson<T> g(n, inf): 弧重みの型 T, 頂点数 n, 容量無限大の値が inf の有向グラフを構築
     - FordFulkerson<T> g(n): 弧重みの型 T，頂点数 n の有向グラフを構築（容量無限大は T の最大値 / 10 に設定）
-    - g.add_arc(u, v, c): 容量 c の弧 (u, v) を追加
+    - g.add_arc(u, v, c): 容量 c の弧 (u, v) を追加して，弧の番号（0, 1, 2, ...）を返す
     - g.add_edge(u, v, c): 容量 c の辺 {u, v} を追加
     - g.MaximumFlow(s, t): s から t へ至る最大流の値
+    - g.Flow(i), g.Capacity(i): add_arc が返した番号 i の弧の流量と容量
+    - g.UpdateCapacity(i, c): 弧 i の容量を c に変更して，前回の MaximumFlow(s, t) の流れを修復する．
+      流量の値が減った分を返す（続けて g.MaximumFlow(s, t) を呼ぶと追加で流せる量を返す）
+    - g.MinimumCut(): 前回の MaximumFlow(s, t) に対する最小カットの s 側の頂点集合（side[v] = true）
+    - g.CutArcs(): 最小カットに含まれる弧の番号のリスト
 
   # Description
   　Ford-Furkersonのアルゴリズムは増加道法の選び方に工夫のないアルゴリズム．
@@ -24,6 +29,13 @@
   　補助ネットワークにおいて増加道を見つけて，その道に沿って流れを増加させる操作を増加道が
   　存在しなくなるまで繰り返す方法を 増加道法（augmenting path method） と呼ぶ．
 
+  　容量の変更（UpdateCapacity）: 容量を増やす場合や流量以上の値に減らす場合は残余容量を変えるだけでよい．
+  　流量 f より小さい c に減らすと，弧 (u, v) の流量を c にしたことで u に f - c の超過，v に f - c の不足が
+  　生じる．まず残余ネットワークで u から v へ f - c まで流して迂回させ，残った超過は u から s へ
+  　（足りなければ t へ），不足は s から v へ（足りなければ t から）流して解消する．得られる流れは
+  　実行可能なので，続けて MaximumFlow(s, t) を呼ぶと前回の残余ネットワークから増やせる分だけを求める
+  　（最初から解き直さない）．
+
   # Note
     - g.INF の値を問題ごとに適切に割り当てないとオーバーフローする可能性がある
     - 多項式時間アルゴリズムではなく，容量に無理数が含まれると有限ステップで終了しない．
@@ -57,14 +69,17 @@ struct FordFulkerson {
 
     int n;
     std::vector<std::vector<Edge>> adj;
+    std::vector<std::pair<int, int>> arcs;  // (src, index in adj[src]) of each added arc
     const Weight INF;
 
     explicit FordFulkerson(int _n, Weight inf = std::numeric_limits<Weight>::max() / 10)
         : n(_n), adj(n), INF(inf) {}
 
-    void add_arc(const int src, const int dst, const Weight cap) {
-        adj[src].emplace_back(Edge(src, dst, cap, adj[dst].size()));
+    int add_arc(const int src, const int dst, const Weight cap) {
+        arcs.emplace_back(src, adj[src].size());
+        adj[src].emplace_back(Edge(src, dst, cap, adj[dst].size() + (src == dst)));
         adj[dst].emplace_back(Edge(dst, src, 0, adj[src].size() - 1));
+        return arcs.size() - 1;
     }
 
     void add_edge(const int src, const int dst, const Weight cap) {
@@ -73,10 +88,70 @@ struct FordFulkerson {
     }
 
     Weight MaximumFlow(const int s, const int t) {
+        last_s = s; last_t = t;
+        return Augment(s, t, INF);
+    }
+
+    Edge &arc(const int i) { return adj[arcs[i].first][arcs[i].second]; }
+    Weight Flow(const int i) { return adj[arc(i).dst][arc(i).rev].cap; }
+    Weight Capacity(const int i) { return arc(i).cap + Flow(i); }
+
+    // returns how much the value of the flow of the last MaximumFlow(s, t) decreased
+    Weight UpdateCapacity(const int i, const Weight cap) {
+        Edge &e = arc(i);
+        Edge &r = adj[e.dst][e.rev];
+        const int u = e.src, v = e.dst;
+        const Weight f = r.cap;
+        if (f <= cap || last_s == -1) {
+            e.cap = cap - std::min(f, cap); r.cap = std::min(f, cap);
+            return 0;
+        }
+        e.cap = 0; r.cap = cap;
+
+        // u has excess f - cap and v has deficit f - cap
+        const int s = last_s, t = last_t;
+        Weight d = f - cap, change = (u == t ? d : 0) - (v == t ? d : 0);
+        auto send = [&](const int x, const int y, const Weight lim) {
+            if (lim <= 0 || x == y) return Weight(0);
+            const Weight res = Augment(x, y, lim);
+            change += (y == t ? res : 0) - (x == t ? res : 0);
+            return res;
+        };
+        d -= send(u, v, d);
+        Weight ex = (u == s || u == t ? 0 : d), de = (v == s || v == t ? 0 : d);
+        ex -= send(u, s, ex); send(u, t, ex);
+        de -= send(s, v, de); send(t, v, de);
+        return -change;
+    }
+
+    // source side of a minimum cut of the last MaximumFlow (is_source_side[v])
+    std::vector<char> MinimumCut() {
+        std::vector<char> side(n, false);
+        if (last_s == -1) return side;
+        std::vector<int> stk = {last_s};
+        side[last_s] = true;
+        while (!stk.empty()) {
+            const int v = stk.back(); stk.pop_back();
+            for (const auto &e : adj[v])
+                if (!side[e.dst] && 0 < e.cap) { side[e.dst] = true; stk.push_back(e.dst); }
+        }
+        return side;
+    }
+
+    // arcs (numbers returned by add_arc) from the source side to the sink side
+    std::vector<int> CutArcs() {
+        const std::vector<char> side = MinimumCut();
+        std::vector<int> res;
+        for (int i = 0; i < (int)arcs.size(); ++i)
+            if (side[arc(i).src] && !side[arc(i).dst]) res.push_back(i);
+        return res;
+    }
+
+    Weight Augment(const int s, const int t, const Weight limit) {
         Weight flow = 0;
-        while (true) {
+        while (flow < limit) {
             std::vector<bool> visited(n, false);
-            Weight f = Dfs(s, INF, t, visited);
+            Weight f = Dfs(s, limit - flow, t, visited);
             if (f <= 0) break;
             flow += f;
         }
@@ -99,6 +174,9 @@ struct FordFulkerson {
         }
         return 0;
     }
+
+private:
+    int last_s = -1, last_t = -1;
 };
 // -------------8<------- end of library ---------8-------------------------
 
@@ -0,0 +1,257 @@
+/*
+  Maximum flow problem (highest-label push-relabel algorithm)
+  最大流問題（最高ラベル選択のプッシュ・再ラベル法）
+  ===========================================================
+
+  # Problem
+    Input: 有向グラフ G = (V, A), 容量 c : A -> R, s, t \in V
+    Output: s から t へ至る流れで，その値が最大のもの
+
+  # Complexity (n = |V|, m = |A|)
+    - Time: O(n^2 m^{1/2})
+    - Space: O(n + m)
+
+  # Usage
+    - PushRelabel<T> g(n, inf): 弧重みの型 T, 頂点数 n, 容量無限大の値が inf の有向グラフを構築
+    - PushRelabel<T> g(n): 弧重みの型 T，頂点数 n の有向グラフを構築（容量無限大は T の最大値 / 10 に設定）
+    - g.add_arc(u, v, c): 容量 c の弧 (u, v) を追加
+    - g.add_edge(u, v, c): 容量 c の辺 {u, v} を追加
+    - g.MaximumFlow(s, t): s から t へ至る最大流の値
+      （Dinic と同様に残余ネットワークを更新するので，続けて呼ぶと追加で流せる量を返す）
+
+  # Description
+    増加路を探す代わりに，各頂点で流入量が流出量を超えること（超過 excess(v) > 0）を許した
+    プリフロー（preflow）を扱う．はじめに s から出る弧をすべて飽和させて，超過のある頂点
+    （活性頂点）から超過を押し出す（push）ことを繰り返す．各頂点は t への距離の下界となる
+    ラベル d(v) を持ち，残余容量が正で d(u) = d(v) + 1 となる弧 (u, v) にだけ押し出す．
+    押し出せる弧がなければ d(u) = min{d(v) + 1 : (u, v) は残余容量が正} に上げる（relabel）．
+    d(v) >= n となった頂点からは t に到達できないので，その超過は最終的に s に戻す．
+
+    実用上の速さは次の3つの工夫で決まる．
+      + 最高ラベル選択: ラベルごとに活性頂点のバケットを持ち，ラベルが最大の活性頂点から処理する
+      + ギャップ: ラベル h < n の頂点がなくなったら，h < d(v) < n の頂点はもう t に到達できない
+        ので d(v) = n + 1 に上げる．ラベルごとに全頂点の双方向リストを持ち，該当する頂点だけを走査する
+      + 大域的再ラベル: relabel の仕事量が ALPHA n + m を超えるたびに，t から残余ネットワークを
+        逆向きに幅優先探索して正確な距離をラベルにする（t に到達できない頂点は s からの距離 + n）
+
+    第1段階ではラベルが n 未満の頂点だけを処理する．終了時点の excess(t) が最大流の値で，
+    d(v) >= n の頂点の集合が最小カットの s 側になる．第2段階ではラベルをそのまま引き継いで
+    n 以上の頂点も処理し，残った超過を s に戻してプリフローを流れにするので，
+    続けて MaximumFlow を呼ぶことができる．
+
+  # Note
+    - g.INF の値を問題ごとに適切に割り当てないとオーバーフローする可能性がある
+    - s から出る容量無限大の弧が複数あると excess がオーバーフローするので，inf の値に注意する
+    - Dinic（graph/maximum_flow_dinic.cc）と同じインターフェースなので
+      MaximumFlowWithLowerBound<PushRelabel<T>>（graph/maximum_flow_with_lower_bounds.cc）として使える
+    - 比較は compare_speed_cpp/maximum_flow.cc を参照
+
+  # References
+    - A. V. Goldberg and R. E. Tarjan (1988): A new approach to the maximum-flow problem.
+      Journal of the ACM, 35(4), pp. 921--940.
+    - B. V. Cherkassky and A. V. Goldberg (1997): On implementing the push-relabel method for
+      the maximum flow problem. Algorithmica, 19(4), pp. 390--410.
+    - 浅野孝夫：『グラフ・ネットワークアルゴリズムの基礎 数理とCプログラム』．近代科学社，2017，pp. 126--161
+
+  # Verified
+    - [AOJ Network Flow - Maximum Flow]
+      (http://judge.u-aizu.ac.jp/onlinejudge/description.jsp?id=GRL_6_A)
+*/
+
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <limits>
+#include <algorithm>
+
+// -------------------8<------- start of library -------8<------------------------
+template<typename Weight>
+struct PushRelabel {
+    using weight_type = Weight;
+
+    struct Edge {
+        int src, dst, rev;
+        Weight weight;
+        Edge(int f, int t, Weight cap, int rev = 0) :
+            src(f), dst(t), rev(rev), weight(cap) {}
+    };
+
+    static constexpr int ALPHA = 6, BETA = 12;
+    int n;
+    std::vector<std::vector<Edge>> adj;
+    const Weight INF;
+
+    explicit PushRelabel(int _n, Weight inf = std::numeric_limits<Weight>::max() / 10)
+        : n(_n), adj(n), INF(inf) {}
+
+    void add_arc(const int src, const int dst, const Weight cap) {
+        adj[src].emplace_back(Edge(src, dst, cap, adj[dst].size() + (src == dst)));
+        adj[dst].emplace_back(Edge(dst, src, 0, adj[src].size() - 1));
+    }
+
+    void add_edge(const int src, const int dst, const Weight cap) {
+        add_arc(src, dst, cap);
+        add_arc(dst, src, cap);
+    }
+
+    Weight MaximumFlow(const int s, const int t) {
+        if (s == t) return 0;
+        src = s; snk = t;
+        d.assign(n, 0); cur.assign(n, 0); excess.assign(n, 0);
+        active.assign(2 * n + 1, {});
+        head.assign(n, -1); next.assign(n, -1); prev.assign(n, -1);
+        num_arcs = 0;
+        for (const auto &es : adj) num_arcs += es.size();
+
+        for (auto &e : adj[s])
+            if (0 < e.weight && e.dst != s) {
+                excess[e.dst] += e.weight;
+                adj[e.dst][e.rev].weight += e.weight;
+                e.weight = 0;
+            }
+
+        lim = n;
+        GlobalRelabel();
+        Discharge(n);      // phase 1: preflow of maximum value
+        Discharge(2 * n);  // phase 2: returns the remaining excess to s (labels are kept)
+        return excess[t];
+    }
+
+private:
+    int src, snk, lim, hi, lmax;
+    long long work, num_arcs;
+    std::vector<int> d, head, next, prev;  // lists of all the vertices with label < n
+    std::vector<std::size_t> cur;
+    std::vector<Weight> excess;
+    std::vector<std::vector<int>> active;
+
+    void Insert(const int v) {
+        const int h = d[v];
+        prev[v] = -1; next[v] = head[h];
+        if (head[h] != -1) prev[head[h]] = v;
+        head[h] = v;
+        lmax = std::max(lmax, h);
+    }
+
+    void Erase(const int v) {
+        if (prev[v] != -1) next[prev[v]] = next[v];
+        else head[d[v]] = next[v];
+        if (next[v] != -1) prev[next[v]] = prev[v];
+    }
+
+    void Activate(const int v) {
+        if (v == src || v == snk || 2 * n <= d[v]) return;
+        active[d[v]].push_back(v);
+        if (d[v] < lim) hi = std::max(hi, d[v]);
+    }
+
+    void GlobalRelabel() {
+        std::fill(d.begin(), d.end(), 2 * n);
+        d[src] = n;
+        std::fill(head.begin(), head.end(), -1);
+        for (auto &a : active) a.clear();
+        lmax = -1;
+
+        // distances to t, then distances to s (+ n) in the residual network
+        std::queue<int> que;
+        for (const int r : {snk, src}) {
+            const int base = (r == snk ? 0 : n);
+            d[r] = base; que.push(r);
+            while (!que.empty()) {
+                const int v = que.front(); que.pop();
+                for (const auto &e : adj[v]) {
+                    const int u = e.dst;
+                    if (d[u] < 2 * n || 0 >= adj[u][e.rev].weight) continue;
+                    d[u] = d[v] + 1; que.push(u);
+                }
+            }
+        }
+
+        hi = -1;
+        for (int v = 0; v < n; ++v) {
+            cur[v] = 0;
+            if (d[v] < n) Insert(v);
+            if (0 < excess[v]) Activate(v);
+        }
+        work = 0;
+    }
+
+    // all the vertices with label in (h, n) cannot reach t
+    void Gap(const int h) {
+        for (int k = h + 1; k <= lmax; ++k) {
+            for (int v = head[k]; v != -1; v = next[v]) { d[v] = n + 1; cur[v] = 0; }
+            for (int v : active[k]) Activate(v);
+            active[k].clear();
+            head[k] = -1;
+        }
+        lmax = h - 1;
+    }
+
+    void Relabel(const int v) {
+        const int old = d[v];
+        int nd = 2 * n;
+        for (std::size_t i = 0; i < adj[v].size(); ++i) {
+            const Edge &e = adj[v][i];
+            if (0 < e.weight && d[e.dst] + 1 < nd) { nd = d[e.dst] + 1; cur[v] = i; }
+        }
+        work += BETA + adj[v].size();
+
+        if (old < n) {
+            Erase(v);
+            if (head[old] == -1) {
+                Gap(old);
+                nd = std::max(nd, n + 1); cur[v] = 0;
+            }
+        }
+        d[v] = std::min(nd, 2 * n);
+        if (d[v] < n) Insert(v);
+    }
+
+    void Discharge(const int limit) {
+        lim = limit; hi = limit - 1;
+        while (true) {
+            while (0 <= hi && active[hi].empty()) --hi;
+            if (hi < 0) break;
+            const int v = active[hi].back(); active[hi].pop_back();
+
+            while (0 < excess[v]) {
+                if (cur[v] == adj[v].size()) {
+                    Relabel(v);
+                    if (lim <= d[v]) { Activate(v); break; }
+                    hi = std::max(hi, d[v]);
+                    continue;
+                }
+                Edge &e = adj[v][cur[v]];
+                if (0 < e.weight && d[v] == d[e.dst] + 1) {
+                    const Weight delta = std::min(excess[v], e.weight);
+                    e.weight -= delta;
+                    adj[e.dst][e.rev].weight += delta;
+                    excess[v] -= delta;
+                    if (excess[e.dst] == 0) Activate(e.dst);
+                    excess[e.dst] += delta;
+                }
+                else ++cur[v];
+            }
+
+            if (ALPHA * n + num_arcs < work) GlobalRelabel();
+        }
+    }
+};
+// ------------------8<------- end of library ---------8-------------------------
+
+int main() {
+    std::cin.tie(0); std::ios::sync_with_stdio(false);
+
+    int n, m;
+    std::cin >> n >> m;
+
+    PushRelabel<long long> pr(n);
+    for (int i = 0, u, v, c; i < m; ++i) {
+        std::cin >> u >> v >> c;
+        pr.add_arc(u, v, c);
+    }
+
+    std::cout << pr.MaximumFlow(0, n - 1) << std::endl;
+
+    return 0;
+}
@@ -24,6 +24,7 @@
 
   # Note
     - Ford-Fulkerson method を使うとエラーが発生するので Dinic's algorithm を使用
+      （同じインターフェースの PushRelabel<T>（graph/maximum_flow_push_relabel.cc）も使える）
     - 弧重みが浮動小数点数のときは，MaximumFlowメソッド内の != を適切なものに変更する必要あり
     - 問題名の和訳が正しいのか不明
 
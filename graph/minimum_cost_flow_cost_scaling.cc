@@ -0,0 +1,240 @@
+/*
+  Minimum cost flow problem (cost scaling push-relabel algorithm)
+  最小費用流問題（費用スケーリングによるプッシュ・再ラベル法）
+  ===============================================================
+
+  # Problem
+    Input: 有向グラフ G = (V, A), 容量 c : A -> R_{>=0}, 費用 w : A -> Z, s, t \in V, 流量 F
+    Output: s から t へ至る値 F の流れ f で，費用 Σ_{a \in A} w(a) f(a) が最小のもの
+
+  # Complexity (n = |V|, m = |A|, C = 費用の絶対値の最大値)
+    - Time: O(n^2 m log(n C))（最初の最大流はディニッツのアルゴリズムで O(n^2 m)）
+    - Space: O(n + m)
+
+  # Usage
+    - CostScaling<T, U> g(n, inf): 容量の型 T, 費用の型 U（整数）, 頂点数 n, 容量無限大の値が inf の
+      有向グラフを構築（inf を省略すると T の最大値 / 10）
+    - g.add_arc(u, v, c, w): 容量 c, 費用 w の弧 (u, v) を追加して，弧の番号（0, 1, 2, ...）を返す
+    - g.MinimumCostFlow(s, t, F): s から t へ最大 F だけ流して，(流量, 費用) の組を返す．
+      流量が F より小さければ値 F の流れは存在しない（F を省略すると最小費用最大流）
+      （続けて呼ぶと追加で流した分の (流量, 費用) を返す）
+    - g.Flow(i): add_arc が返した番号 i の弧の流量
+
+  # Description
+  　まず s から t へ値 min{F, 最大流の値} の流れをディニッツのアルゴリズム（graph/maximum_flow_dinic.cc）
+  　で求めて，残余ネットワークの負閉路を費用スケーリングで取り除く（最小費用循環流問題）．
+
+  　ポテンシャル p に対して弧の被約費用を w_p(u, v) = w(u, v) + p(u) - p(v) とする．残余ネットワークの
+  　すべての弧で w_p >= -ε となる p が存在する流れを ε-最適 という．費用を n + 1 倍した整数費用で
+  　1-最適ならば元の費用で最適である．ε = (n + 1) C から始めて，ε を 1/ALPHA にしながら
+  　ε-最適な流れに直す操作（Refine）を ε = 1 まで繰り返す．
+
+  　Refine(ε) は w_p < 0 の弧をすべて飽和させて，超過の生じた頂点（活性頂点）をキューに入れる．
+  　活性頂点 v から w_p < 0 かつ残余容量が正の弧（許容弧）に沿って超過を押し出し（push），
+  　許容弧がなければ p(v) = max{p(u) - w(v, u) : (v, u) は残余容量が正} - ε に下げる（relabel）．
+  　Refine の前の流れが αε-最適ならば，各頂点の relabel は O(n) 回に抑えられる．
+
+  # Note
+    - 費用が負の閉路があってもよい（最短路繰り返し法 graph/minimum_cost_flow_successive_shortest_path.cc
+      は負閉路を扱えない）
+    - 費用を n + 1 倍するので，ポテンシャルは O(n^2 C) の大きさになる．U のオーバーフローに注意
+    - 容量が inf 以上の弧の残余容量は，負閉路を取り除く間だけ有限の容量の和に制限する．
+      容量 inf の弧だけからなる費用が負の閉路があると最適解が存在しない
+    - 流量が小さいときや，費用の種類が少ないときは最短路繰り返し法の方が速い
+      （比較は compare_speed_cpp/minimum_cost_flow.cc を参照）
+    - 容量下界がある場合は graph/minimum_cost_flow_with_lower_bounds.cc
+
+  # References
+    - A. V. Goldberg and R. E. Tarjan (1990): Finding minimum-cost circulations by successive
+      approximation. Mathematics of Operations Research, 15(3), pp. 430--466.
+    - A. V. Goldberg (1997): An efficient implementation of a scaling minimum-cost flow algorithm.
+      Journal of Algorithms, 22(1), pp. 1--29.
+
+  # Verified
+    - [AOJ Network Flow - Minimum Cost Flow]
+      (http://judge.u-aizu.ac.jp/onlinejudge/description.jsp?id=GRL_6_B)
+*/
+
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <limits>
+#include <utility>
+#include <algorithm>
+
+//  @require ./maximum_flow_dinic.cc 👇👇
+
+// -------------------8<------- start of library -------8<------------------------
+template<typename Weight, typename Cost>
+struct CostScaling {
+    using weight_type = Weight;
+    using cost_type = Cost;
+
+    struct Edge {
+        int dst, rev;
+        Weight cap;
+        Cost cost;
+        Edge(int t, Weight c, Cost w, int r) : dst(t), rev(r), cap(c), cost(w) {}
+    };
+
+    static constexpr int ALPHA = 16;
+    int n;
+    std::vector<std::vector<Edge>> adj;
+    std::vector<std::pair<int, int>> arcs;  // (src, index in adj[src]) of each added arc
+    const Weight INF;
+
+    explicit CostScaling(int _n, Weight inf = std::numeric_limits<Weight>::max() / 10)
+        : n(_n), adj(n), INF(inf) {}
+
+    int add_arc(const int src, const int dst, const Weight cap, const Cost cost) {
+        arcs.emplace_back(src, adj[src].size());
+        adj[src].emplace_back(dst, cap, cost, adj[dst].size() + (src == dst));
+        adj[dst].emplace_back(src, 0, -cost, adj[src].size() - 1);
+        return arcs.size() - 1;
+    }
+
+    Weight Flow(const int i) const {
+        const Edge &e = adj[arcs[i].first][arcs[i].second];
+        return adj[e.dst][e.rev].cap;
+    }
+
+    std::pair<Weight, Cost> MinimumCostFlow(const int s, const int t, const Weight limit) {
+        const Cost before = TotalCost();
+        Weight flow = 0;
+        if (s != t) {
+            // a flow of value min{limit, max flow} in the residual network; vertex n is the source
+            Dinic<Weight> mf(n + 1, INF);
+            for (const auto &a : arcs) {
+                const Edge &e = adj[a.first][a.second];
+                mf.add_arc(a.first, e.dst, e.cap);
+                mf.add_arc(e.dst, a.first, adj[e.dst][e.rev].cap);
+            }
+            mf.add_arc(n, s, limit);
+            flow = mf.MaximumFlow(n, t);
+            for (std::size_t i = 0; i < arcs.size(); ++i) {
+                Edge &e = adj[arcs[i].first][arcs[i].second];
+                const Weight delta = mf.Flow(2 * i) - mf.Flow(2 * i + 1);
+                e.cap -= delta;
+                adj[e.dst][e.rev].cap += delta;
+            }
+        }
+        CancelNegativeCycles();
+        return {flow, TotalCost() - before};
+    }
+
+    std::pair<Weight, Cost> MinimumCostFlow(const int s, const int t) {
+        return MinimumCostFlow(s, t, INF);
+    }
+
+private:
+    Cost scale;
+    std::vector<Cost> price;
+    std::vector<Weight> excess;
+    std::vector<std::size_t> cur;
+
+    Cost TotalCost() const {
+        Cost res = 0;
+        for (std::size_t i = 0; i < arcs.size(); ++i)
+            res += Cost(Flow(i)) * adj[arcs[i].first][arcs[i].second].cost;
+        return res;
+    }
+
+    Cost Reduced(const int v, const Edge &e) const {
+        return e.cost * scale + price[v] - price[e.dst];
+    }
+
+    void CancelNegativeCycles() {
+        Cost max_c = 0;
+        for (const auto &es : adj)
+            for (const auto &e : es) max_c = std::max(max_c, e.cost);
+        scale = n + 1;
+        price.assign(n, 0);
+        excess.assign(n, 0);
+        cur.assign(n, 0);
+
+        // the flow on an arc changes by at most the sum of the finite capacities,
+        // so the residual capacities are clamped to avoid the overflow of the excesses
+        Weight bound = 0;
+        for (const auto &a : arcs) {
+            const Edge &e = adj[a.first][a.second];
+            if (e.cap + adj[e.dst][e.rev].cap < INF) bound += e.cap + adj[e.dst][e.rev].cap;
+        }
+        std::vector<Weight> extra(arcs.size(), 0);
+        for (std::size_t i = 0; i < arcs.size(); ++i) {
+            Edge &e = adj[arcs[i].first][arcs[i].second];
+            if (bound < e.cap) { extra[i] = e.cap - bound; e.cap = bound; }
+        }
+
+        for (Cost eps = max_c * scale; 1 < eps; ) {
+            eps = std::max<Cost>(1, eps / ALPHA);
+            Refine(eps);
+        }
+        for (std::size_t i = 0; i < arcs.size(); ++i) adj[arcs[i].first][arcs[i].second].cap += extra[i];
+    }
+
+    // makes the circulation eps-optimal
+    void Refine(const Cost eps) {
+        std::queue<int> que;
+        for (int v = 0; v < n; ++v)
+            for (auto &e : adj[v])
+                if (0 < e.cap && Reduced(v, e) < 0) {
+                    excess[v] -= e.cap;
+                    excess[e.dst] += e.cap;
+                    adj[e.dst][e.rev].cap += e.cap;
+                    e.cap = 0;
+                }
+        for (int v = 0; v < n; ++v) {
+            cur[v] = 0;
+            if (0 < excess[v]) que.push(v);
+        }
+
+        while (!que.empty()) {
+            const int v = que.front(); que.pop();
+            while (0 < excess[v]) {
+                if (cur[v] == adj[v].size()) { Relabel(v, eps); continue; }
+                Edge &e = adj[v][cur[v]];
+                if (0 < e.cap && Reduced(v, e) < 0) {
+                    const Weight delta = std::min(excess[v], e.cap);
+                    e.cap -= delta;
+                    adj[e.dst][e.rev].cap += delta;
+                    excess[v] -= delta;
+                    if (excess[e.dst] <= 0 && 0 < excess[e.dst] + delta) que.push(e.dst);
+                    excess[e.dst] += delta;
+                }
+                else ++cur[v];
+            }
+        }
+    }
+
+    void Relabel(const int v, const Cost eps) {
+        Cost p = std::numeric_limits<Cost>::min();
+        for (std::size_t i = 0; i < adj[v].size(); ++i) {
+            const Edge &e = adj[v][i];
+            if (0 < e.cap && p < price[e.dst] - e.cost * scale) {
+                p = price[e.dst] - e.cost * scale;
+                cur[v] = i;
+            }
+        }
+        price[v] = p - eps;
+    }
+};
+// ------------------8<------- end of library ---------8-------------------------
+
+int main() {
+    std::cin.tie(0); std::ios::sync_with_stdio(false);
+
+    // AOJ GRL_6_B: Network Flow - Minimum Cost Flow
+    int n, m, f;
+    std::cin >> n >> m >> f;
+
+    CostScaling<int, long long> g(n);
+    for (int i = 0, u, v, c, d; i < m; ++i) {
+        std::cin >> u >> v >> c >> d;
+        g.add_arc(u, v, c, d);
+    }
+
+    const auto res = g.MinimumCostFlow(0, n - 1, f);
+    std::cout << (res.first < f ? -1 : res.second) << std::endl;
+
+    return 0;
+}
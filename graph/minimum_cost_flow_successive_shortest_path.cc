@@ -0,0 +1,195 @@
+/*
+  Minimum cost flow problem (successive shortest path algorithm with potentials)
+  最小費用流問題（ポテンシャルを用いた最短路繰り返し法）
+  ===============================================================================
+
+  # Problem
+    Input: 有向グラフ G = (V, A), 容量 c : A -> R_{>=0}, 費用 w : A -> R, s, t \in V, 流量 F
+    Output: s から t へ至る値 F の流れ f で，費用 Σ_{a \in A} w(a) f(a) が最小のもの
+
+  # Complexity (n = |V|, m = |A|, F = 流量)
+    - Time: O(F (n + m) log n)（費用が負の弧があるときは最初に O(n m) のベルマン・フォード法）
+    - Space: O(n + m)
+
+  # Usage
+    - SuccessiveShortestPath<T, U> g(n, inf): 容量の型 T, 費用の型 U, 頂点数 n, 容量無限大の値が inf の
+      有向グラフを構築（inf を省略すると T の最大値 / 10）
+    - SuccessiveShortestPath<T, U, Queue> g(n): 最短路に使う優先度付きキュー Queue を指定して構築
+      （graph/dijkstra_heap.cc の BinaryHeap<U>（デフォルト）または RadixHeap<U>（U が整数のとき））
+    - g.add_arc(u, v, c, w): 容量 c, 費用 w の弧 (u, v) を追加して，弧の番号（0, 1, 2, ...）を返す
+    - g.MinimumCostFlow(s, t, F): s から t へ最大 F だけ流して，(流量, 費用) の組を返す．
+      流量が F より小さければ値 F の流れは存在しない（F を省略すると最小費用最大流）
+      （残余ネットワークを更新するので，続けて呼ぶと追加で流した分の (流量, 費用) を返す）
+    - g.Flow(i): add_arc が返した番号 i の弧の流量
+
+  # Description
+  　流れ f が値 |f| の流れの中で費用最小であることと，残余ネットワークに負閉路が存在しないことは同値．
+  　最短路繰り返し法は，残余ネットワークで s から t への費用最小の道を求めて，その道に沿って
+  　流せるだけ流すことを繰り返す．費用最小の道に沿って流しても負閉路はできないので，
+  　各段階の流れはその値で費用最小になっている．
+
+  　頂点にポテンシャル p を与えて弧の費用を w_p(u, v) = w(u, v) + p(u) - p(v) とすると，
+  　s-t 道の費用は p(s) - p(t) だけずれるので最短路は変わらない．p を直前の最短距離にすると，
+  　残余ネットワークのすべての弧で w_p >= 0 となるので，ダイクストラ法で最短路が求まる（Johnson）．
+  　ダイクストラ法は t が確定した時点で打ち切り，p(v) に min{d(v), d(t)} を足して更新する．
+  　最初の p は，費用が負の弧がなければ 0，あればベルマン・フォード法で求める．
+
+  # Note
+    - 費用が負の閉路があってはならない（負閉路を含む場合は graph/minimum_cost_flow_cost_scaling.cc）
+    - 費用の計算 流量 * 費用 がオーバーフローしないように型 U を選ぶ
+    - 流量が大きく，容量がまちまちな大規模ネットワークでは graph/minimum_cost_flow_cost_scaling.cc の方が速い
+      （比較は compare_speed_cpp/minimum_cost_flow.cc を参照）
+    - 容量下界がある場合は graph/minimum_cost_flow_with_lower_bounds.cc
+
+  # References
+    - R. K. Ahuja, T. L. Magnanti, and J. B. Orlin (1993): Network Flows: Theory, Algorithms,
+      and Applications. Prentice Hall, pp. 320--324.
+    - J. Edmonds and R. M. Karp (1972): Theoretical improvements in algorithmic efficiency for
+      network flow problems. Journal of the ACM, 19(2), pp. 248--264.
+    - あり本 pp. 199--203
+
+  # Verified
+    - [AOJ Network Flow - Minimum Cost Flow]
+      (http://judge.u-aizu.ac.jp/onlinejudge/description.jsp?id=GRL_6_B)
+*/
+
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <utility>
+#include <tuple>
+#include <algorithm>
+
+//  @require ./dijkstra_heap.cc 👇👇
+
+// -------------------8<------- start of library -------8<------------------------
+template<typename Weight, typename Cost, class Queue = BinaryHeap<Cost>>
+struct SuccessiveShortestPath {
+    using weight_type = Weight;
+    using cost_type = Cost;
+
+    struct Edge {
+        int dst, rev;
+        Weight cap;
+        Cost cost;
+        Edge(int t, Weight c, Cost w, int r) : dst(t), rev(r), cap(c), cost(w) {}
+    };
+
+    int n;
+    std::vector<std::vector<Edge>> adj;
+    std::vector<std::pair<int, int>> arcs;  // (src, index in adj[src]) of each added arc
+    std::vector<Cost> potential;
+    const Weight INF;
+
+    explicit SuccessiveShortestPath(int _n, Weight inf = std::numeric_limits<Weight>::max() / 10)
+        : n(_n), adj(n), INF(inf) {}
+
+    int add_arc(const int src, const int dst, const Weight cap, const Cost cost) {
+        arcs.emplace_back(src, adj[src].size());
+        adj[src].emplace_back(dst, cap, cost, adj[dst].size() + (src == dst));
+        adj[dst].emplace_back(src, 0, -cost, adj[src].size() - 1);
+        potential.clear();  // may have created an arc of negative reduced cost
+        return arcs.size() - 1;
+    }
+
+    Weight Flow(const int i) const {
+        const Edge &e = adj[arcs[i].first][arcs[i].second];
+        return adj[e.dst][e.rev].cap;
+    }
+
+    std::pair<Weight, Cost> MinimumCostFlow(const int s, const int t, const Weight limit) {
+        if (potential.empty()) InitPotential();
+        Weight flow = 0;
+        Cost cost = 0;
+        while (flow < limit && s != t && Dijkstra(s, t)) {
+            Weight delta = limit - flow;
+            for (int v = t; v != s; v = adj[v][prev[v]].dst) {
+                const Edge &r = adj[v][prev[v]];
+                delta = std::min(delta, adj[r.dst][r.rev].cap);
+            }
+            for (int v = t; v != s; v = adj[v][prev[v]].dst) {
+                Edge &r = adj[v][prev[v]];
+                adj[r.dst][r.rev].cap -= delta;
+                r.cap += delta;
+            }
+            flow += delta;
+            cost += Cost(delta) * (potential[t] - potential[s]);
+        }
+        return {flow, cost};
+    }
+
+    std::pair<Weight, Cost> MinimumCostFlow(const int s, const int t) {
+        return MinimumCostFlow(s, t, INF);
+    }
+
+private:
+    std::vector<Cost> dist;
+    std::vector<int> prev;  // index of the reverse arc in adj[v] of the arc entering v
+    Queue que;
+
+    // Bellman-Ford from a virtual source joined to every vertex by an arc of cost 0
+    void InitPotential() {
+        potential.assign(n, 0);
+        bool negative = false;
+        for (const auto &es : adj)
+            for (const auto &e : es) negative |= (0 < e.cap && e.cost < 0);
+        if (!negative) return;
+
+        for (int k = 0; k < n; ++k) {
+            bool updated = false;
+            for (int v = 0; v < n; ++v)
+                for (const auto &e : adj[v])
+                    if (0 < e.cap && potential[v] + e.cost < potential[e.dst]) {
+                        potential[e.dst] = potential[v] + e.cost;
+                        updated = true;
+                    }
+            if (!updated) break;
+        }
+    }
+
+    // shortest path with respect to the reduced costs; stops when t is settled
+    bool Dijkstra(const int s, const int t) {
+        const Cost UNREACHED = std::numeric_limits<Cost>::max();
+        dist.assign(n, UNREACHED);
+        prev.assign(n, -1);
+        que.reset(0);
+        dist[s] = 0; que.push(0, s);
+        while (!que.empty()) {
+            Cost d; int v;
+            std::tie(d, v) = que.pop();
+            if (dist[v] < d) continue;
+            if (v == t) break;
+            for (const auto &e : adj[v]) {
+                if (e.cap <= 0) continue;
+                const Cost nd = d + e.cost + potential[v] - potential[e.dst];
+                if (nd < dist[e.dst]) {
+                    dist[e.dst] = nd; prev[e.dst] = e.rev;
+                    que.push(nd, e.dst);
+                }
+            }
+        }
+        if (dist[t] == UNREACHED) return false;
+        for (int v = 0; v < n; ++v) potential[v] += std::min(dist[v], dist[t]);
+        return true;
+    }
+};
+// ------------------8<------- end of library ---------8-------------------------
+
+int main() {
+    std::cin.tie(0); std::ios::sync_with_stdio(false);
+
+    // AOJ GRL_6_B: Network Flow - Minimum Cost Flow
+    int n, m, f;
+    std::cin >> n >> m >> f;
+
+    SuccessiveShortestPath<int, long long> g(n);
+    for (int i = 0, u, v, c, d; i < m; ++i) {
+        std::cin >> u >> v >> c >> d;
+        g.add_arc(u, v, c, d);
+    }
+
+    const auto res = g.MinimumCostFlow(0, n - 1, f);
+    std::cout << (res.first < f ? -1 : res.second) << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,123 @@
+/*
+  Minimum cost flow with lower bounds problem
+  容量下界制約付き最小費用流問題
+  ===========================================
+
+  # Problem
+    Input: 有向グラフ G = (V, A), 容量 c : A -> R, 容量下界 lb : A -> R, 費用 w : A -> R,
+           s, t \in V, 流量 F
+    Output: s から t へ至る値 F の流れ f で，その費用 Σ_{a \in A} w(a) f(a) が最小のもの
+    　　　　　（ただし，どの弧 a に対しても lb(a) <= f(a) <= c(a) を満たす）
+
+  # Complexity (n = |V|, m = |A|)
+    - Time: 使用する最小費用流のアルゴリズムで，頂点数 n + 2, 弧数 3m + 2 のネットワークを解く時間
+    - Space: O(n + m)
+
+  # Usage
+    - using algo = Algorithm<T, U>: 容量の型 T, 費用の型 U の最小費用流問題を解くアルゴリズム
+      （SuccessiveShortestPath<T, U> または CostScaling<T, U>）
+    - MinimumCostFlowWithLowerBound<algo> g(n): 頂点数 n の有向グラフを構築
+    - MinimumCostFlowWithLowerBound<algo> g(n, inf): 頂点数 n, 容量無限大の値が inf の有向グラフを構築
+    - g.add_arc(u, v, lb, ub, w): 容量制約の下界 lb と上界 ub, 費用 w の弧 (u, v) を追加して，
+      弧の番号（0, 1, 2, ...）を返す
+    - g.MinimumCostFlow(s, t, F): s から t へ至る値 F の容量下界制約付き流れの最小費用 c について
+      (true, c) を返す．そのような流れが存在しなければ (false, 0) を返す
+    - g.Flow(i): add_arc が返した番号 i の弧の流量（MinimumCostFlow が true を返したときのみ）
+
+  # Description
+  　容量下界制約付き最大流問題（graph/maximum_flow_with_lower_bounds.cc）と同様に super source S と
+  　super sink T を追加する．弧 (u, v) を容量 ub - lb, 費用 w の弧 (u, v) と，容量 lb, 費用 0 の弧
+  　(S, v), (u, T) に置き換えて，さらに容量 F の弧 (S, s), (t, T) を追加する．
+  　S から出る弧の容量の和は Σ lb + F なので，S から T への値 Σ lb + F の流れは S から出る弧と T に入る弧を
+  　すべて飽和させる．これは各弧に lb だけ流したうえで s から t へ F 流すことに対応するので，
+  　S から T への値 Σ lb + F の最小費用流に Σ lb w を足したものが答えになる．
+
+  # Note
+    - MinimumCostFlow は1回だけ呼ぶ（呼ぶたびに弧 (S, s), (t, T) が追加される）
+    - 費用が負の閉路がある場合は CostScaling を使う
+    - 弧重みが浮動小数点数のときは，MinimumCostFlowメソッド内の != を適切なものに変更する必要あり
+
+  # References
+    - R. K. Ahuja, T. L. Magnanti, and J. B. Orlin (1993): Network Flows: Theory, Algorithms,
+      and Applications. Prentice Hall, pp. 191--194.
+    - [@snuke 最小流量制限付き最大流](https://snuke.hatenablog.com/entry/2016/07/10/043918)
+*/
+
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <cassert>
+
+//  @require ./minimum_cost_flow_successive_shortest_path.cc 👇👇
+//  @require ./minimum_cost_flow_cost_scaling.cc 👇👇
+
+// -------------------8<------- start of library -------8<------------------------
+template<class Algorithm>
+struct MinimumCostFlowWithLowerBound {
+    using Weight = typename Algorithm::weight_type;
+    using Cost = typename Algorithm::cost_type;
+
+    Algorithm algo;
+    const int SuperSource, SuperSink;
+    Weight sum_lb = 0;
+    Cost base_cost = 0;
+    std::vector<std::pair<int, Weight>> arcs;  // (arc number in algo, lower bound)
+
+    MinimumCostFlowWithLowerBound(int n)
+        : algo(n + 2), SuperSource(n), SuperSink(n + 1) {}
+
+    MinimumCostFlowWithLowerBound(int n, Weight inf)
+        : algo(n + 2, inf), SuperSource(n), SuperSink(n + 1) {}
+
+    int add_arc(const int src, const int dst, const Weight lb, const Weight ub, const Cost cost) {
+        assert(0 <= lb && lb <= ub);
+        arcs.emplace_back(algo.add_arc(src, dst, ub - lb, cost), lb);
+        if (0 < lb) {
+            algo.add_arc(SuperSource, dst, lb, 0);
+            algo.add_arc(src, SuperSink, lb, 0);
+            sum_lb += lb;
+            base_cost += Cost(lb) * cost;
+        }
+        return arcs.size() - 1;
+    }
+
+    Weight Flow(const int i) const { return arcs[i].second + algo.Flow(arcs[i].first); }
+
+    std::pair<bool, Cost> MinimumCostFlow(const int s, const int t, const Weight f) {
+        algo.add_arc(SuperSource, s, f, 0);
+        algo.add_arc(t, SuperSink, f, 0);
+        // Weight が浮動小数点数型なら != に注意
+        const auto res = algo.MinimumCostFlow(SuperSource, SuperSink, sum_lb + f);
+        if (res.first != sum_lb + f) return {false, 0};
+        return {true, base_cost + res.second};
+    }
+};
+// ------------------8<------- end of library ---------8-------------------------
+
+int main() {
+    std::cin.tie(0); std::ios::sync_with_stdio(false);
+
+    int n, m;
+    std::cin >> n >> m;
+
+    using Weight = int;
+    using Cost = long long;
+    MinimumCostFlowWithLowerBound<SuccessiveShortestPath<Weight, Cost>> g(n);
+    for (int i = 0; i < m; ++i) {
+        int src, dst;
+        Weight lb, ub;
+        Cost cost;
+        std::cin >> src >> dst >> lb >> ub >> cost;
+        g.add_arc(src, dst, lb, ub, cost);
+    }
+
+    int Source, Sink;
+    Weight f;
+    std::cin >> Source >> Sink >> f;
+
+    const auto res = g.MinimumCostFlow(Source, Sink, f);
+    if (!res.first) std::cout << "infeasible\n";
+    else std::cout << "Minimum cost is " << res.second << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,254 @@
+/*
+  Incremental strongly connected components (Pearce-Kelly with component merging)
+  弧の追加に対する強連結成分の動的な管理
+  ===============================================================================
+
+  # Problem
+    Input: 頂点数 n の有向グラフ G = (V, E)（最初は弧なし）
+    Query:
+      + 弧 (u, v) を追加する
+      + u と v が同じ強連結成分に属するか
+      + 成分グラフでのトポロジカル順序
+
+    Def. 強連結(strongly connected), 強連結成分, 成分グラフ
+      -> graph/strongly_connected_component_kosaraju.cc
+
+  # Complexity (n = |V|, m = |E|)
+    Time:
+      + add_arc(u, v): 順序を変える必要がある範囲（下記の F, B）の頂点数と弧数を k として O(k log k)
+        （順序が変わらない弧は O(α(n))．最悪の総和は O(m n) だが実用上は変化した部分だけに比例する）
+      + add_arcs(arcs): 1本ずつ追加して，弧の数が n + m の 1/REBUILD_RATIO 以上になるか
+        探索した弧の数が (n + m) / REBUILD_RATIO を超えたら残りをまとめて O(n + m) で作り直す
+      + same(u, v), order(v): O(α(n))
+    Memory: O(n + m)
+
+  # Usage
+    - IncrementalScc scc(n): 頂点数 n の弧のないグラフを構築
+    - scc.add_arc(u, v): 弧 (u, v) を追加する. 新しい閉路ができて成分が併合されたら true を返す
+    - scc.add_arcs(arcs): 弧の列 arcs = {(u, v), ...} をまとめて追加する
+    - scc.find(v): v が属する強連結成分の代表元
+    - scc.same(u, v): u と v が同じ強連結成分に属するか
+    - scc.order(v): v が属する強連結成分の成分グラフでのトポロジカル順序
+      （弧 (u, v) に対して order(u) <= order(v)．値は連続とは限らない）
+    - scc.num_comp: 強連結成分の数
+    - scc.merged: 代表元が変わった頂点の列（利用者が clear するまで追加され続ける）
+
+  # Description
+    成分グラフのトポロジカル順序 ord を保ちながら弧を追加する（Pearce-Kelly）．
+    強連結成分は union-find で管理して，代表元が成分の弧のリスト（out, in）と頂点のリストを持つ．
+    弧 (u, v) を追加して a = find(u), b = find(v) とする．ord[a] < ord[b] ならば順序はそのまま使える．
+    ord[b] < ord[a] のときは
+      F: b から ord <= ord[a] の成分だけをたどって到達できる成分の集合
+      B: a へ逆向きに ord >= ord[b] の成分だけをたどって到達できる成分の集合
+    を求める．a \in F ならば新しい閉路ができていて，F ∩ B の成分（b から a への道の上の成分）を
+    1つに併合する．その後 F ∪ B の成分が使っていた ord の値を集めて昇順に並べ，
+    小さい方から B \ F（元の順序），併合した成分，大きい方から F \ B（元の順序）に割り当て直す．
+    F の成分は順位が上がり B の成分は順位が下がるだけなので，F ∪ B の外の成分との弧の向きは
+    保たれる．F ∪ B の外の成分の ord は変わらないので，調べる範囲は変化した部分だけになる．
+
+    併合では頂点数の最も大きい成分を代表元にして，残りの成分の弧と頂点のリストを後ろに追加する
+    （併合の総コストは弧と頂点について O((n + m) log n)）．成分の内部を指す古い弧は
+    探索でたどるときに find で判定してリストから取り除く．
+
+    まとめて追加する弧が多いときや探索の範囲が広いときは，1本ずつ順序を直すより，弧を追加してから
+    成分グラフの上で Tarjan のアルゴリズム（再帰なし）を実行して成分と順序を作り直す方が速い．
+    add_arcs は探索した弧の数を数えて，作り直すコストを超えた時点で作り直しに切り替える．
+
+  # Note
+    - 弧の削除はできない
+    - 大きな強連結成分を探索するとその成分の弧をすべて走査するので，ランダムなグラフのように
+      巨大な成分ができる場合は1本ずつより add_arcs でまとめて追加する方が速い
+    - 2-SAT の節を少しずつ追加して解き直す用途は other/two_sat.cc を参照
+    - 静的なグラフならば graph/strongly_connected_component_pearce.cc の方が速い
+
+  # References
+    - D. J. Pearce and P. H. J. Kelly (2007): A dynamic topological sort algorithm for directed
+      acyclic graphs. ACM Journal of Experimental Algorithmics, 11, Article 1.7.
+    - D. J. Pearce (2016): A space-efficient algorithm for finding strongly connected components.
+      Information Processing Letters, 116(1), pp. 47--52.
+    - B. Haeupler, T. Kavitha, R. Mathew, S. Sen, and R. E. Tarjan (2012): Incremental cycle
+      detection, topological ordering, and strong component maintenance.
+      ACM Transactions on Algorithms, 8(1), Article 3.
+*/
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+// -------------8<------- start of library -------8<------------------------
+struct IncrementalScc {
+    static constexpr int REBUILD_RATIO = 4;
+    int n, m = 0, num_comp;
+    std::vector<int> par, ord, merged;
+    std::vector<std::vector<int>> out, in, member;
+
+    explicit IncrementalScc(int _n)
+        : n(_n), num_comp(n), par(n), ord(n), out(n), in(n), member(n), mark(n, 0) {
+        std::iota(par.begin(), par.end(), 0);
+        std::iota(ord.begin(), ord.end(), 0);
+        for (int v = 0; v < n; ++v) member[v].push_back(v);
+    }
+
+    int find(int v) {
+        while (par[v] != v) v = par[v] = par[par[v]];
+        return v;
+    }
+    bool same(int u, int v) { return find(u) == find(v); }
+    int order(int v) { return ord[find(v)]; }
+
+    bool add_arc(const int u, const int v) {
+        const int a = find(u), b = find(v);
+        out[a].push_back(v); in[b].push_back(u); ++m;
+        if (ord[a] < ord[b] || a == b) return false;
+
+        // F: forward from b (mark bit 1), B: backward from a (mark bit 2)
+        const int lb = ord[b], ub = ord[a];
+        std::vector<int> fw = Search(b, 1, out, [&](int c) { return ord[c] <= ub; });
+        std::vector<int> bw = Search(a, 2, in, [&](int c) { return lb <= ord[c]; });
+        const bool cycle = (mark[a] & 1);
+
+        std::vector<int> pool, lo, hi, cyc;
+        for (int c : bw) {
+            pool.push_back(ord[c]);
+            if (mark[c] & 1) cyc.push_back(c); else lo.push_back(c);
+        }
+        for (int c : fw) {
+            if (!(mark[c] & 2)) { pool.push_back(ord[c]); hi.push_back(c); }
+        }
+        for (int c : fw) mark[c] = 0;
+        for (int c : bw) mark[c] = 0;
+
+        auto by_ord = [&](int x, int y) { return ord[x] < ord[y]; };
+        std::sort(pool.begin(), pool.end());
+        std::sort(lo.begin(), lo.end(), by_ord);
+        std::sort(hi.begin(), hi.end(), by_ord);
+
+        std::size_t i = 0;
+        for (int c : lo) ord[c] = pool[i++];
+        if (cycle) ord[Merge(cyc)] = pool[i];
+        i = pool.size() - hi.size();
+        for (int c : hi) ord[c] = pool[i++];
+        return cycle;
+    }
+
+    void add_arcs(const std::vector<std::pair<int, int>> &arcs) {
+        std::size_t i = 0;
+        if (REBUILD_RATIO * arcs.size() < std::size_t(n + m)) {
+            // gives up when the searches cost more than rebuilding
+            const long long budget = (n + m) / REBUILD_RATIO;
+            for (work = 0; i < arcs.size() && work <= budget; ++i) add_arc(arcs[i].first, arcs[i].second);
+            if (i == arcs.size()) return;
+        }
+        for (; i < arcs.size(); ++i) {
+            out[find(arcs[i].first)].push_back(arcs[i].second);
+            in[find(arcs[i].second)].push_back(arcs[i].first);
+            ++m;
+        }
+        Rebuild();
+    }
+
+private:
+    std::vector<int> mark;
+    long long work = 0;  // number of arcs scanned by Search
+
+    template<class F>
+    std::vector<int> Search(const int s, const int bit,
+                            std::vector<std::vector<int>> &adj, F in_range) {
+        std::vector<int> visited = {s};
+        mark[s] |= bit;
+        for (std::size_t k = 0; k < visited.size(); ++k) {
+            const int c = visited[k];
+            std::size_t j = 0;
+            work += adj[c].size();
+            for (int v : adj[c]) {
+                const int d = find(v);
+                if (d == c) continue;  // drops arcs inside the component
+                adj[c][j++] = v;
+                if ((mark[d] & bit) || !in_range(d)) continue;
+                mark[d] |= bit;
+                visited.push_back(d);
+            }
+            adj[c].resize(j);
+        }
+        return visited;
+    }
+
+    // merges the components in cs and returns the new representative
+    int Merge(const std::vector<int> &cs) {
+        int r = cs[0];
+        for (int c : cs) if (member[r].size() < member[c].size()) r = c;
+        for (int c : cs) {
+            if (c == r) continue;
+            par[c] = r;
+            merged.insert(merged.end(), member[c].begin(), member[c].end());
+            member[r].insert(member[r].end(), member[c].begin(), member[c].end());
+            out[r].insert(out[r].end(), out[c].begin(), out[c].end());
+            in[r].insert(in[r].end(), in[c].begin(), in[c].end());
+            std::vector<int>().swap(member[c]);
+            std::vector<int>().swap(out[c]);
+            std::vector<int>().swap(in[c]);
+            --num_comp;
+        }
+        return r;
+    }
+
+    // Tarjan's algorithm on the current component graph (without recursion)
+    void Rebuild() {
+        std::vector<int> index(n, -1), low(n), stk, cs;
+        std::vector<std::pair<int, int>> call;  // (component, next position in out)
+        std::vector<char> on_stack(n, false);
+
+        // components are found in reverse topological order
+        for (int s = 0, t = 0, k = 0; s < n; ++s) {
+            if (find(s) != s || index[s] != -1) continue;
+            index[s] = low[s] = t++; stk.push_back(s); on_stack[s] = true;
+            call.emplace_back(s, 0);
+            while (!call.empty()) {
+                const int c = call.back().first;
+                int &i = call.back().second;
+                if (i < (int)out[c].size()) {
+                    const int d = find(out[c][i++]);
+                    if (index[d] == -1) {
+                        index[d] = low[d] = t++; stk.push_back(d); on_stack[d] = true;
+                        call.emplace_back(d, 0);
+                    }
+                    else if (on_stack[d]) low[c] = std::min(low[c], index[d]);
+                    continue;
+                }
+                call.pop_back();
+                if (!call.empty()) {
+                    const int p = call.back().first;
+                    low[p] = std::min(low[p], low[c]);
+                }
+                if (low[c] != index[c]) continue;
+                cs.clear();
+                int d;
+                do {
+                    d = stk.back(); stk.pop_back();
+                    on_stack[d] = false; cs.push_back(d);
+                } while (d != c);
+                ord[Merge(cs)] = n - 1 - k++;
+            }
+        }
+    }
+};
+// -------------8<------- end of library ---------8-------------------------
+
+int main() {
+    std::cin.tie(0); std::ios::sync_with_stdio(false);
+
+    // 弧を1本ずつ追加して，追加するたびに u と v が同じ強連結成分に属するかを出力
+    int n, m;
+    std::cin >> n >> m;
+
+    IncrementalScc scc(n);
+    for (int i = 0, u, v; i < m; ++i) {
+        std::cin >> u >> v;
+        scc.add_arc(u, v);
+        std::cout << scc.same(u, v) << '\n';
+    }
+
+    return 0;
+}
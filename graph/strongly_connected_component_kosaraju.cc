@@ -39,6 +39,10 @@
     成分グラフでのトポロジカルソート順で逆辺に従って Dfs を行うので，現在着目している頂点の強連結成分以外の場所には訪れない．
     scc はトポロジカルソートの順番と対応する．
 
+  # Note
+    - 逆向きの隣接リストを持たない1パスの非再帰版は graph/strongly_connected_component_pearce.cc
+    - 複数スレッドで並列に求める版は graph/strongly_connected_component_parallel.cc
+
   # References
     - [spagetthi-source @tmaehara]
       (https://github.com/spaghetti-source/algorithm/blob/master/graph/strongly_connected_component_kosaraju.cc)
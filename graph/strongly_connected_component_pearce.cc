@@ -0,0 +1,174 @@
+/*
+  Decomposition of strongly connected components (Pearce)
+  強連結成分分解（Pearce のアルゴリズム，再帰を使わない1パス）
+  ===========================================================
+
+  # Problem
+    Input: 有向グラフ G = (V, E)
+    Output: G 強連結成分分解（と成分グラフ）
+
+    Def. 強連結(strongly connected), 強連結成分, 成分グラフ
+      -> graph/strongly_connected_component_kosaraju.cc
+
+  # Complexity (n = |V|, m = |E|)
+    Time: O(n + m)
+    Memory: O(n + m)（グラフ以外に頂点ごとに int 1つとスタック 3n 語）
+
+  # Usage
+    - CsrGraph<T> g(n): 頂点数 n の有向グラフ（graph/csr_graph.cc）
+    - g.add_arc(u, v), g.build(): 弧 (u, v) を追加して隣接配列を構築
+    - PearceScc<T> scc(g): g の強連結成分分解を行う
+    - scc.StronglyConnectedComponents(): 強連結成分の数を返す
+    - scc.scc[v]: v が属する強連結成分の番号（成分グラフのトポロジカルソート順）
+    - scc.Condensation(): 成分グラフを CsrGraph<T> として返す（多重弧はまとめて重みは最小値，
+      弧の辺番号は成分グラフでの通し番号）
+
+  # Description
+    Tarjan のアルゴリズムは頂点ごとに訪問順 index, lowlink, スタックに入っているかのフラグを持つ．
+    Pearce は lowlink の値をそのまま index の配列 rindex に上書きし，強連結成分が確定した頂点の
+    rindex には成分の番号を n から降順に書き込む（0 は未訪問を表す）．成分が確定するたびに index を
+    確定した頂点数だけ戻すので，常に「処理中の頂点の rindex < 確定した頂点の rindex」となり，
+    確定した頂点への弧で rindex が更新されることはない（フラグが不要）．
+    v が強連結成分の根かどうかのフラグは v が DFS のスタックにある間しか使わないので，
+    ここでは DFS のスタック（頂点と次に調べる弧の位置）にまとめて持っている．
+
+    成分は成分グラフのシンクから順に確定するので，n から降順に付けた番号を
+    0 から始まるように詰めると成分グラフのトポロジカルソート順になる．
+    逆向きのグラフは使わない．
+
+  # Note
+    - Kosaraju のアルゴリズム（graph/strongly_connected_component_kosaraju.cc）と違って
+      逆向きの隣接リストを持たず，1回の DFS で求まる．また深いグラフでもスタックが溢れない
+
+  # References
+    - D. J. Pearce (2016): A space-efficient algorithm for finding strongly connected components.
+      Information Processing Letters, 116(1), pp. 47--52.
+    - R. E. Tarjan (1972): Depth-first search and linear graph algorithms.
+      SIAM Journal on Computing, 1(2), pp. 146--160.
+
+  # Verified
+    - [AOJ GRL_3_C Connected Components - Strongly Connected Components]
+      (http://judge.u-aizu.ac.jp/onlinejudge/description.jsp?id=GRL_3_C)
+*/
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+//  @require ./csr_graph.cc 👇👇
+
+// -------------8<------- start of library -------8<------------------------
+template<class T = int>
+struct PearceScc {
+    const CsrGraph<T> &g;
+    int num_comp = 0;
+    std::vector<int> scc;  // rindex during the search
+
+    explicit PearceScc(const CsrGraph<T> &_g) : g(_g), scc(g.n, 0) { Solve(); }
+
+    int StronglyConnectedComponents() const { return num_comp; }
+
+    CsrGraph<T> Condensation() const {
+        std::vector<int> head(num_comp + 1, 0), order(g.n);
+        for (int v = 0; v < g.n; ++v) ++head[scc[v] + 1];
+        for (int c = 0; c < num_comp; ++c) head[c + 1] += head[c];
+        {
+            std::vector<int> pos(head.begin(), head.end() - 1);
+            for (int v = 0; v < g.n; ++v) order[pos[scc[v]]++] = v;
+        }
+
+        CsrGraph<T> dag(num_comp);
+        dag.head.assign(num_comp + 1, 0);
+        std::vector<int> mark(num_comp, -1), pos(num_comp);
+        for (int c = 0; c < num_comp; ++c) {
+            for (int k = head[c]; k < head[c + 1]; ++k) {
+                const int v = order[k];
+                for (int i = g.head[v]; i < g.head[v + 1]; ++i) {
+                    const int d = scc[g.to[i]];
+                    if (d == c) continue;
+                    if (mark[d] != c) {
+                        mark[d] = c; pos[d] = dag.to.size();
+                        dag.to.push_back(d); dag.weight.push_back(g.weight[i]);
+                    }
+                    else dag.weight[pos[d]] = std::min(dag.weight[pos[d]], g.weight[i]);
+                }
+            }
+            dag.head[c + 1] = dag.to.size();
+        }
+        dag.m = dag.to.size();
+        dag.id.resize(dag.m);
+        for (int i = 0; i < dag.m; ++i) dag.id[i] = i;
+        return dag;
+    }
+
+private:
+    void Solve() {
+        const int n = g.n;
+        int index = 1, c = n;  // 0 is reserved for unvisited vertices
+        std::vector<std::pair<int, int>> call;  // (vertex, next arc); root flag is the sign of the arc
+        std::vector<int> stack;
+        for (int r = 0; r < n; ++r) {
+            if (scc[r] != 0) continue;
+            scc[r] = index++;
+            call.emplace_back(r, g.head[r]);
+            while (!call.empty()) {
+                const int v = call.back().first;
+                int &it = call.back().second;
+                const bool root = (0 <= it);
+                int i = root ? it : ~it;
+                if (i < g.head[v + 1]) {
+                    const int w = g.to[i];
+                    if (scc[w] == 0) {  // descend; the arc is examined again after returning
+                        scc[w] = index++;
+                        call.emplace_back(w, g.head[w]);
+                        continue;
+                    }
+                    ++i;
+                    bool r2 = root;
+                    if (scc[w] < scc[v]) { scc[v] = scc[w]; r2 = false; }
+                    it = r2 ? i : ~i;
+                    continue;
+                }
+
+                call.pop_back();
+                if (root) {
+                    --index;
+                    while (!stack.empty() && scc[v] <= scc[stack.back()]) {
+                        scc[stack.back()] = c; stack.pop_back(); --index;
+                    }
+                    scc[v] = c--;
+                }
+                else stack.push_back(v);
+            }
+        }
+        num_comp = n - c;
+        for (auto &x : scc) x -= c + 1;
+    }
+};
+// -------------8<------- end of library ---------8-------------------------
+
+int main() {
+    std::cin.tie(0); std::ios::sync_with_stdio(false);
+
+    // AOJ GRL_3_C Connected Components - Strongly Connected Components
+    int n, m, v[2];
+    std::cin >> n >> m;
+
+    CsrGraph<> g(n);
+    for (int i = 0; i < m; ++i) {
+        std::cin >> v[0] >> v[1];
+        g.add_arc(v[0], v[1]);
+    }
+    g.build();
+
+    PearceScc<> scc(g);
+
+    int q;
+    std::cin >> q;
+    while (q--) {
+        std::cin >> v[0] >> v[1];
+        std::cout << (scc.scc[v[0]] == scc.scc[v[1]]) << '\n';
+    }
+
+    return 0;
+}
@@ -66,6 +66,8 @@
 #include <algorithm>
 
 // @require algorithm/other/counting_sort.cc
+// @require algorithm/graph/csr_graph.cc
+// @require algorithm/graph/bfs_direction_optimizing.cc
 
 // -------------8<------- start of library -------8<------------------------
 struct Tree {
@@ -79,25 +81,22 @@ struct Tree {
     }
 
     std::vector<int> centers() {
-        std::vector<int> prev(n);
+        CsrGraph<> g(n);
+        for (int u = 0; u < n; ++u)
+            for (int v : adj[u])
+                if (u < v) g.add_edge(u, v);
+        g.build();
+
+        // one thread; the engine still chooses between top-down and bottom-up at each level
+        DirectionOptimizingBfs<> bfs(g, 1);
         int u = 0;
         for (int i = 0; i < 2; ++i) { // double sweap
-            prev.assign(n, -1);
-            std::queue<int> que;
-            que.push(prev[u] = u);
-            while (!que.empty()) {
-                u = que.front(); que.pop();
-                for (auto v : adj[u]) {
-                    if (prev[v] == -1) {
-                        prev[v] = u;
-                        que.push(v);
-                    }
-                }
-            }
+            bfs.Run(u);
+            u = std::max_element(bfs.dist.begin(), bfs.dist.end()) - bfs.dist.begin();
         }
 
         std::vector<int> path = {u};
-        while (prev[u] != u) path.push_back(u = prev[u]);
+        while (bfs.parent[u] != u) path.push_back(u = bfs.parent[u]);
 
         if (path.size() % 2 == 1) return {path[path.size() / 2]};
         else return {path[path.size() / 2 - 1], path[path.size() / 2]};
@@ -19,21 +19,23 @@
       eg.) φ は充足可能である．その真偽値割当は (x1, x2, x3) = (t, t, f)
 
   # Complexity
-    - Time: O(n + m)
+    - Time: O(n + m)（Solve() は O(1)．節の追加は graph/strongly_connected_component_incremental.cc）
     - Space: O(n + m)
 
   # Usage
     - TwoSat sat(n): n変数からなる2-CNF式を構築 (x_i は i, !x_i は i + n に番号付け)
     - sat.add_clause(lt1, ng1, lt2, ng2): 節 (lt1 v lt2) を追加（ng1, ng2 は各リテラルの符号）
-    - sat.Solve(): 充足可能かどうかを判定する
-    - sat.Check(): 充足可能性かどうか（事前に sat.Solve() を行う）
-    - sat.val[i]: x_i の真偽値割当（充足可能の場合のみ意味を持つ）
+    - sat.add_clauses(cs): 節の列 cs = {(lt1, ng1, lt2, ng2), ...} をまとめて追加
+    - sat.Solve(): 充足可能かどうかを判定する（節を追加した後に何度でも呼べる）
+    - sat.Check(): 直前の sat.Solve() の結果（Solve() を呼ぶ前や，その後に節を追加した場合は false）
+    - sat.Value(i): x_i の真偽値割当（充足可能の場合のみ意味を持つ）
 
   # Note
     次の論理演算は 2SAT を保ちながら同値変形可能
     　・含意 x => y: !x v y
     　・同値 x <=> y: (!x v y) ^ (x v !y)
     　・二重否定 !!x: x
+    真偽値割当は Value(i) を呼んだ時点のトポロジカル順序から求める．
 
   # Description
     k-SAT問題 (k >= 3) はNP完全だが，2-SAT問題は線形時間で解くことができる．
@@ -46,7 +48,15 @@
     リテラル x, y が同じ強連結成分に属しているとき含意の推移性から x <=> y となるので，
     G の各強連結成分に属する頂点に対応するリテラルに対して同じ真偽値割当を行う．
     このとき，ある変数 x に対して，x と !x が同じ強連結成分に属しているとき x <=> !x より矛盾が生じるので
-    充足不能となる．充足可能なときにはトポロジカルソート順で x が !x よりも前にあるとき真を割り当てる．
+    充足不能となる．充足可能なときにはトポロジカルソート順で !x が x よりも前にあるとき x に真を割り当てる．
+
+    節を少しずつ追加しては解き直す場合に，毎回グラフ全体の強連結成分分解をやり直すと
+    1回の Solve() に O(n + m) 時間かかる．ここでは Implication graph の強連結成分と
+    成分グラフのトポロジカル順序を弧の追加に対して動的に管理する（IncrementalScc）．
+    弧の追加で順序が変わる範囲だけを調べ直し，成分が併合されたときは代表元が変わった
+    リテラル x について x と !x が同じ成分になったかだけを調べるので，
+    解き直しのコストは追加した節が影響する範囲に比例する．
+    多くの節をまとめて追加するときは add_clauses を使うと，必要に応じて成分分解を作り直す．
 
   # References
     - あり本．pp. 288-290.
@@ -59,32 +69,49 @@
 
 #include <iostream>
 #include <vector>
+#include <tuple>
 
-//  @require ../graph/strongly_connected_component_kosaraju.cc 👇👇
+//  @require ../graph/strongly_connected_component_incremental.cc 👇👇
 
 // -------------8<------- start of library -------8<------------------------
 struct TwoSat {
     const int n;
-    std::vector<bool> val;
-    Graph g;
+    bool solved = false, ok = true;
+    IncrementalScc g;
 
-    explicit TwoSat(int _n) : n(_n), val(n + 1), g(2 * n) {}
+    explicit TwoSat(int _n) : n(_n), g(2 * n) {}
 
     void add_clause(int lt1, bool ng1, int lt2, bool ng2) {
-        g.add_edge(lt1 + (ng1 ? n : 0), lt2 + (ng2 ? 0 : n));
-        g.add_edge(lt2 + (ng2 ? n : 0), lt1 + (ng1 ? 0 : n));
+        solved = false;
+        g.add_arc(lt1 + (ng1 ? n : 0), lt2 + (ng2 ? 0 : n));
+        g.add_arc(lt2 + (ng2 ? n : 0), lt1 + (ng1 ? 0 : n));
+    }
+
+    void add_clauses(const std::vector<std::tuple<int, bool, int, bool>> &cs) {
+        solved = false;
+        std::vector<std::pair<int, int>> arcs;
+        arcs.reserve(2 * cs.size());
+        for (const auto &c : cs) {
+            int lt1, lt2; bool ng1, ng2;
+            std::tie(lt1, ng1, lt2, ng2) = c;
+            arcs.emplace_back(lt1 + (ng1 ? n : 0), lt2 + (ng2 ? 0 : n));
+            arcs.emplace_back(lt2 + (ng2 ? n : 0), lt1 + (ng1 ? 0 : n));
+        }
+        g.add_arcs(arcs);
     }
 
-    bool Check() const { return val[n]; }
+    bool Check() const { return solved && ok; }
 
     bool Solve() {
-        g.StronglyConnectedComponents();
-        for (int x = 0; x < n; ++x) {
-            if (g.scc[x] == g.scc[x + n]) return val[n] = false;
-            val[x] = (g.scc[x] > g.scc[x + n]);
-        }
-        return val[n] = true;
+        // only the literals whose component changed can newly meet their negation
+        for (int x : g.merged)
+            if (g.same(x, x < n ? x + n : x - n)) ok = false;
+        g.merged.clear();
+        solved = true;
+        return ok;
     }
+
+    bool Value(int x) { return g.order(x) > g.order(x + n); }
 };
 // -------------8<------- end of library ---------8-------------------------
 